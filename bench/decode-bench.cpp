@@ -0,0 +1,136 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/// Measures the decode stage of the receive path (framing + protobuf
+/// parsing in FrameReader) and counts heap allocations per node.
+///
+/// usage: decode-bench [nodes] [chunk_size]
+
+#include "../framereader.hh"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+static std::atomic<long long> alloc_count{0};
+
+void* operator new(std::size_t n) {
+  alloc_count++;
+  if (void* p = std::malloc(n)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+static void appendFrame(std::string& stream, const message::Node& node) {
+  std::string body;
+  node.SerializeToString(&body);
+  uint32_t size = body.size();
+  stream.append(reinterpret_cast<const char*>(&size), 4);
+  stream.append(body);
+}
+
+/// A stream of NODE messages resembling a binary search tree
+static std::string makeStream(int nodes, int nogood_every) {
+  std::string stream;
+  message::Node node;
+  for (int i = 0; i < nodes; ++i) {
+    node.Clear();
+    node.set_type(message::Node::NODE);
+    node.set_sid(i);
+    node.set_pid(i == 0 ? -1 : (i - 1) / 2);
+    node.set_alt(i == 0 ? 0 : (i - 1) % 2);
+    node.set_kids(2);
+    node.set_status(message::Node::BRANCH);
+    node.set_restart_id(0);
+    node.set_time(i * 10);
+    node.set_thread_id(0);
+    node.set_label("x[" + std::to_string(i % 100) + "]=" + std::to_string(i % 7));
+    if (nogood_every > 0 && i % nogood_every == 0) {
+      node.set_nogood("x[1]!=3 \\/ x[2]!=4 \\/ x[" + std::to_string(i) + "]!=1");
+    }
+    appendFrame(stream, node);
+  }
+  return stream;
+}
+
+struct Result {
+  long long nodes = 0;
+  long long allocs = 0;
+  double seconds = 0;
+};
+
+/// Feed `stream` to a FrameReader in pieces of `chunk` bytes, as a socket
+/// would, and decode every frame.  The first pass warms up the reader.
+static Result decode(const std::string& stream, size_t chunk) {
+  FrameReader reader;
+  Result res;
+
+  for (int pass = 0; pass < 2; ++pass) {
+    res = Result{};
+    auto begin = std::chrono::steady_clock::now();
+    long long allocs_before = alloc_count;
+
+    size_t pos = 0;
+    while (pos < stream.size()) {
+      uint64_t space;
+      char* dst = reader.buffer().writeSpan(space);
+      size_t n = std::min<size_t>({space, chunk, stream.size() - pos});
+      std::memcpy(dst, stream.data() + pos, n);
+      reader.buffer().commit(n);
+      pos += n;
+
+      while (message::Node* msg = reader.next()) {
+        res.nodes += (msg->type() == message::Node::NODE);
+      }
+    }
+
+    res.allocs = alloc_count - allocs_before;
+    res.seconds = std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - begin).count();
+  }
+  return res;
+}
+
+static bool report(const char* name, const Result& r, bool expect_zero) {
+  std::cout << name << ": " << r.nodes << " nodes, "
+            << static_cast<long long>(r.nodes / r.seconds) << " nodes/s, "
+            << r.allocs << " allocations ("
+            << static_cast<double>(r.allocs) / r.nodes << " per node)\n";
+  return !expect_zero || r.allocs == 0;
+}
+
+int main(int argc, char* argv[]) {
+  const int nodes = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  const size_t chunk = argc > 2 ? std::atoi(argv[2]) : 64 * 1024;
+
+  bool ok = true;
+  ok &= report("labels only", decode(makeStream(nodes, 0), chunk), true);
+  ok &= report("with nogoods", decode(makeStream(nodes, 4), chunk), true);
+
+  std::cout << (ok ? "PASS" : "FAIL")
+            << ": decode stage allocation-free in steady state\n";
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,22 @@
+# Decode stage benchmark (framing + parsing, no Qt involved)
+#
+#   mkdir build-bench && cd build-bench
+#   qmake ../bench/decode-bench.pro && make && ./decode-bench
+
+TEMPLATE = app
+TARGET = decode-bench
+CONFIG += console
+CONFIG -= qt app_bundle
+
+QMAKE_CXXFLAGS += -std=c++11 -O2
+
+INCLUDEPATH += ..
+
+SOURCES += decode-bench.cpp \
+    ../framereader.cpp \
+    ../message.pb.cpp
+
+HEADERS += ../framereader.hh \
+    ../ringbuffer.hh
+
+LIBS += `pkg-config --cflags --libs protobuf` -lprotobuf
@@ -0,0 +1,206 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/// Bytes per node of the different ways of sending the same search:
+/// one NODE message per node, plain NODE_BATCH messages, and DELTA-encoded
+/// batches with a label dictionary.  Also checks that the DELTA batches
+/// decode back to the original columns.
+///
+/// usage: encoding-bench [nodes] [threads] [batch_size]
+
+#include "../message.pb.hh"
+#include "../libs/delta_codec.hh"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct SynthNode {
+  int sid, pid, alt, kids, status, thread;
+  unsigned long long time;
+  std::string label;
+};
+
+/// Depth-first search on `threads` threads, each exploring its own subtree
+/// of a binary tree and numbering its nodes consecutively
+static std::vector<SynthNode> makeSearch(int nodes, int threads) {
+  std::vector<SynthNode> out;
+  std::vector<std::vector<std::pair<int, int>>> stacks(threads);
+  std::vector<int> next_sid(threads);
+  std::vector<unsigned long long> clock(threads);
+  for (int t = 0; t < threads; ++t) {
+    next_sid[t] = t * (nodes + 1);
+    stacks[t].push_back({-1, 0});
+  }
+
+  unsigned seed = 1;
+  auto rnd = [&seed]() { return (seed = seed * 1103515245 + 12345) >> 16; };
+
+  for (int i = 0; i < nodes; ++i) {
+    const int t = i % threads;
+    auto& stack = stacks[t];
+    if (stack.empty()) stack.push_back({-1, 0});
+    auto top = stack.back();
+    stack.pop_back();
+
+    SynthNode n;
+    n.sid = next_sid[t]++;
+    n.pid = top.first;
+    n.alt = top.second;
+    n.thread = t;
+    n.time = (clock[t] += 5 + rnd() % 40);
+    const bool fail = rnd() % 3 == 0 && stack.size() > 4;
+    n.kids = fail ? 0 : 2;
+    n.status = fail ? 1 : 2;
+    const int var = rnd() % 50, val = rnd() % 10;
+    n.label = "x[" + std::to_string(var) + "]" + (top.second ? "!=" : "=") +
+              std::to_string(val);
+    if (!fail) {
+      stack.push_back({n.sid, 1});
+      stack.push_back({n.sid, 0});
+    }
+    out.push_back(n);
+  }
+  return out;
+}
+
+static size_t frameSize(const message::Node& msg) {
+  return msg.ByteSizeLong() + 4;
+}
+
+static size_t perNode(const std::vector<SynthNode>& search) {
+  size_t bytes = 0;
+  message::Node msg;
+  for (const auto& n : search) {
+    msg.Clear();
+    msg.set_type(message::Node::NODE);
+    msg.set_sid(n.sid);
+    msg.set_pid(n.pid);
+    msg.set_alt(n.alt);
+    msg.set_kids(n.kids);
+    msg.set_status(static_cast<message::Node::NodeStatus>(n.status));
+    msg.set_restart_id(-1);
+    msg.set_time(n.time);
+    msg.set_thread_id(n.thread);
+    msg.set_label(n.label);
+    bytes += frameSize(msg);
+  }
+  return bytes;
+}
+
+static void fillBatch(message::NodeBatch& batch, const SynthNode& n) {
+  batch.add_sid(n.sid);
+  batch.add_pid(n.pid);
+  batch.add_alt(n.alt);
+  batch.add_kids(n.kids);
+  batch.add_status(n.status);
+  batch.add_time(n.time);
+  batch.add_thread_id(n.thread);
+}
+
+/// Plain batches with a per-batch label table
+static size_t plainBatches(const std::vector<SynthNode>& search, int size) {
+  size_t bytes = 0;
+  message::Node msg;
+  std::unordered_map<std::string, int> table;
+  for (size_t i = 0; i < search.size(); i += size) {
+    msg.Clear();
+    msg.set_type(message::Node::NODE_BATCH);
+    auto& batch = *msg.mutable_batch();
+    table.clear();
+    for (size_t j = i; j < search.size() && j < i + size; ++j) {
+      fillBatch(batch, search[j]);
+      auto it = table.find(search[j].label);
+      if (it == table.end()) {
+        it = table.emplace(search[j].label, table.size()).first;
+        batch.add_label_table(search[j].label);
+      }
+      batch.add_label(it->second);
+    }
+    bytes += frameSize(msg);
+  }
+  return bytes;
+}
+
+/// DELTA batches with labels declared in LABEL_DICT messages; returns
+/// false in `ok` if decoding does not give back the original columns
+static size_t deltaBatches(const std::vector<SynthNode>& search, int size,
+                           bool& ok) {
+  size_t bytes = 0;
+  message::Node msg, dict;
+  delta_codec::Encoder<message::NodeBatch> encoder;
+  delta_codec::Decoder<message::NodeBatch> decoder;
+  std::unordered_map<std::string, int> labels;
+
+  for (size_t i = 0; i < search.size(); i += size) {
+    msg.Clear();
+    msg.set_type(message::Node::NODE_BATCH);
+    dict.Clear();
+    dict.set_type(message::Node::LABEL_DICT);
+    dict.set_first_label_id(labels.size());
+
+    auto& batch = *msg.mutable_batch();
+    for (size_t j = i; j < search.size() && j < i + size; ++j) {
+      fillBatch(batch, search[j]);
+      auto it = labels.find(search[j].label);
+      if (it == labels.end()) {
+        it = labels.emplace(search[j].label, labels.size()).first;
+        dict.add_labels(search[j].label);
+      }
+      batch.add_label_id(it->second);
+    }
+    encoder.encode(batch);
+    if (dict.labels_size() > 0) bytes += frameSize(dict);
+    bytes += frameSize(msg);
+
+    decoder.decode(batch);
+    for (int k = 0; k < batch.sid_size(); ++k) {
+      const SynthNode& n = search[i + k];
+      ok &= batch.sid(k) == n.sid && batch.pid(k) == n.pid &&
+            batch.time(k) == n.time;
+    }
+  }
+  return bytes;
+}
+
+int main(int argc, char* argv[]) {
+  const int nodes = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  const int threads = argc > 2 ? std::atoi(argv[2]) : 4;
+  const int batch_size = argc > 3 ? std::atoi(argv[3]) : 1024;
+
+  auto search = makeSearch(nodes, threads);
+
+  bool ok = true;
+  const double node = static_cast<double>(perNode(search)) / nodes;
+  const double plain = static_cast<double>(plainBatches(search, batch_size)) / nodes;
+  const double delta =
+      static_cast<double>(deltaBatches(search, batch_size, ok)) / nodes;
+
+  std::cout << "NODE messages:       " << node << " bytes/node\n"
+            << "plain batches:       " << plain << " bytes/node\n"
+            << "delta batches:       " << delta << " bytes/node ("
+            << node / delta << "x smaller than NODE)\n";
+
+  std::cout << (ok ? "PASS" : "FAIL") << ": delta batches decode correctly\n";
+  return ok ? 0 : 1;
+}
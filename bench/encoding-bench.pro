@@ -0,0 +1,20 @@
+# Bytes per node of the wire encodings (no Qt involved)
+#
+#   mkdir build-bench && cd build-bench
+#   qmake ../bench/encoding-bench.pro && make && ./encoding-bench
+
+TEMPLATE = app
+TARGET = encoding-bench
+CONFIG += console
+CONFIG -= qt app_bundle
+
+QMAKE_CXXFLAGS += -std=c++11 -O2
+
+INCLUDEPATH += ..
+
+SOURCES += encoding-bench.cpp \
+    ../message.pb.cpp
+
+HEADERS += ../libs/delta_codec.hh
+
+LIBS += `pkg-config --cflags --libs protobuf` -lprotobuf
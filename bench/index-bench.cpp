@@ -0,0 +1,91 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/// Bytes per node of the sid index for a search without restarts
+/// (restart_id -1, as solvers send it) and for the same search in a
+/// restart, and bytes of index per string of a BlobStore holding a
+/// nogood for every node.  Checks that all of them stay in the dense
+/// tables and that every sid maps back.
+///
+/// usage: index-bench [nodes] [nogood_bytes]
+
+#include "../sidindex.hh"
+#include "../blobstore.hh"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+static int64_t fullSid(int32_t restart_id, int32_t sid) {
+  return static_cast<int64_t>(static_cast<uint64_t>(static_cast<uint32_t>(restart_id)) << 32 |
+                              static_cast<uint32_t>(sid));
+}
+
+/// Index `nodes` sids of restart `restart_id`; false in `ok` if any of
+/// them went to the hash map or does not map back
+static size_t indexRestart(int32_t restart_id, int nodes, bool& ok) {
+  SidIndex index;
+  for (int sid = 0; sid < nodes; ++sid) index.insert(fullSid(restart_id, sid), sid);
+  for (int sid = 0; sid < nodes; ++sid) ok &= index.find(fullSid(restart_id, sid)) == sid;
+  ok &= index.find(fullSid(restart_id, nodes)) == -1;
+  ok &= index.sparseSize() == 0;
+  return index.bytes();
+}
+
+/// Bytes of index per string of a store holding a `size`-byte nogood for
+/// every sid of restart `restart_id`; false in `ok` if one does not read back
+static double indexPerString(int32_t restart_id, int nodes, int size, bool& ok) {
+  BlobStore store;
+  for (int sid = 0; sid < nodes; ++sid) {
+    std::string blob(size, 'a' + sid % 26);
+    store.add(fullSid(restart_id, sid), blob);
+  }
+  for (int sid = 0; sid < nodes; ++sid) {
+    ok &= store.get(fullSid(restart_id, sid)) == std::string(size, 'a' + sid % 26);
+  }
+  return static_cast<double>(store.bytes() - store.rawBytes()) / nodes;
+}
+
+int main(int argc, char* argv[]) {
+  const int nodes = argc > 1 ? std::atoi(argv[1]) : 100000;
+  const int nogood_bytes = argc > 2 ? std::atoi(argv[2]) : 40;
+
+  bool ok = true;
+  for (int32_t restart_id : {-1, 0, 3}) {
+    bool dense = true;
+    const size_t bytes = indexRestart(restart_id, nodes, dense);
+    std::cout << "restart " << restart_id << ": " << bytes << " bytes, "
+              << static_cast<double>(bytes) / nodes << " bytes/node"
+              << (dense ? "" : " (not dense)") << "\n";
+    ok &= dense;
+  }
+
+  for (int32_t restart_id : {-1, 0}) {
+    const double overhead = indexPerString(restart_id, nodes, nogood_bytes, ok);
+    std::cout << "nogoods, restart " << restart_id << ": " << overhead
+              << " bytes/string over the strings themselves\n";
+    /// a 4-byte dense slot and an 8-byte offset, plus slack in the blocks
+    ok &= overhead < 16;
+  }
+
+  std::cout << (ok ? "PASS" : "FAIL") << ": sids and strings of every restart are indexed densely\n";
+  return ok ? 0 : 1;
+}
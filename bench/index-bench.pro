@@ -0,0 +1,23 @@
+# Memory of the sid index and of nogood strings per node
+#
+#   mkdir build-bench && cd build-bench
+#   qmake ../bench/index-bench.pro && make && ./index-bench
+
+TEMPLATE = app
+TARGET = index-bench
+CONFIG += console
+CONFIG -= app_bundle
+QT = core
+
+QMAKE_CXXFLAGS += -std=c++11 -O2
+
+INCLUDEPATH += ..
+
+SOURCES += index-bench.cpp \
+    ../sidindex.cpp \
+    ../blobstore.cpp \
+    ../mappedstore.cpp
+
+HEADERS += ../sidindex.hh \
+    ../blobstore.hh \
+    ../mappedstore.hh
@@ -0,0 +1,167 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/// Many simulated solvers sending to the profiler at once: compares the
+/// IngestReactor (all connections on one or a few threads) with a thread
+/// per connection, as the profiler used to do.
+///
+/// With decode threads, the reactor only frames and the frames are parsed
+/// by a DecodePool.
+///
+/// usage: ingest-bench [connections] [nodes_per_connection] [reactor_threads]
+///                     [decode_threads]
+
+#include "../ingest-reactor.hh"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static std::atomic<long long> received{0};
+static std::atomic<int> finished{0};
+
+/// Stands in for ExecutionReceiver: counts the nodes
+class CountingConnection : public IngestConnection {
+ public:
+  using IngestConnection::IngestConnection;
+
+ protected:
+  void handleMessage(message::Node& msg) override {
+    if (msg.type() == message::Node::NODE) received++;
+    if (msg.type() == message::Node::NODE_BATCH) received += msg.batch().sid_size();
+  }
+  void onClosed() override { finished++; }
+};
+
+/// What a solver sends: `nodes` NODE frames followed by DONE
+static std::string makeStream(int nodes) {
+  std::string stream, body;
+  message::Node node;
+  auto frame = [&]() {
+    node.SerializeToString(&body);
+    uint32_t size = body.size();
+    stream.append(reinterpret_cast<const char*>(&size), 4);
+    stream.append(body);
+  };
+  for (int i = 0; i < nodes; ++i) {
+    node.Clear();
+    node.set_type(message::Node::NODE);
+    node.set_sid(i);
+    node.set_pid(i == 0 ? -1 : (i - 1) / 2);
+    node.set_alt(i == 0 ? 0 : (i - 1) % 2);
+    node.set_kids(2);
+    node.set_status(message::Node::BRANCH);
+    node.set_time(i * 10);
+    node.set_label("x[" + std::to_string(i % 100) + "]=" + std::to_string(i % 7));
+    frame();
+  }
+  node.Clear();
+  node.set_type(message::Node::DONE);
+  frame();
+  return stream;
+}
+
+/// Solver side: write the stream in pieces of about 4kB
+static void sendStream(int fd, const std::string& stream) {
+  for (size_t pos = 0; pos < stream.size();) {
+    ssize_t n = ::write(fd, stream.data() + pos,
+                        std::min<size_t>(4096, stream.size() - pos));
+    if (n <= 0) break;
+    pos += n;
+  }
+  ::close(fd);
+}
+
+/// Profiler side, the old way: one thread blocking on each connection
+static void threadPerConnection(int fd) {
+  CountingConnection connection(fd);
+  pollfd p{fd, POLLIN, 0};
+  while (poll(&p, 1, -1) >= 0) {
+    if (connection.serve() == IngestConnection::Status::CLOSED) break;
+  }
+}
+
+static double run(int connections, const std::string& stream, int reactors,
+                  int decoders = 0) {
+  received = 0;
+  finished = 0;
+
+  std::vector<int> solver_fds;
+  std::vector<int> profiler_fds;
+  for (int i = 0; i < connections; ++i) {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) abort();
+    solver_fds.push_back(fds[0]);
+    profiler_fds.push_back(fds[1]);
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> threads;
+  std::unique_ptr<IngestPool> pool;
+  if (reactors > 0) {
+    pool.reset(new IngestPool(reactors, decoders));
+    for (int fd : profiler_fds) pool->add(new CountingConnection(fd));
+  } else {
+    for (int fd : profiler_fds) threads.emplace_back(threadPerConnection, fd);
+  }
+
+  std::vector<std::thread> solvers;
+  for (int fd : solver_fds) solvers.emplace_back(sendStream, fd, std::cref(stream));
+  for (auto& t : solvers) t.join();
+
+  while (finished < connections) std::this_thread::yield();
+  for (auto& t : threads) t.join();
+
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       begin).count();
+}
+
+int main(int argc, char* argv[]) {
+  const int connections = argc > 1 ? std::atoi(argv[1]) : 64;
+  const int nodes = argc > 2 ? std::atoi(argv[2]) : 100000;
+  const int reactors = argc > 3 ? std::atoi(argv[3]) : 1;
+  const int decoders = argc > 4 ? std::atoi(argv[4]) : 2;
+
+  const std::string stream = makeStream(nodes);
+  const long long total = static_cast<long long>(connections) * nodes;
+
+  auto report = [&](const char* name, double secs) {
+    std::cout << name << ": " << connections << " connections, " << total
+              << " nodes in " << secs << "s, "
+              << static_cast<long long>(received / secs) << " nodes/s"
+              << (received == total ? "" : " (NODES LOST)") << "\n";
+  };
+
+  report("thread per connection", run(connections, stream, 0));
+  report("reactor", run(connections, stream, reactors));
+  report("reactor + decode pool", run(connections, stream, reactors, decoders));
+
+  return 0;
+}
@@ -0,0 +1,28 @@
+# Ingest benchmark: many simulated solver connections (no Qt involved)
+#
+#   mkdir build-bench && cd build-bench
+#   qmake ../bench/ingest-bench.pro && make && ./ingest-bench 64
+
+TEMPLATE = app
+TARGET = ingest-bench
+CONFIG += console thread
+CONFIG -= qt app_bundle
+
+QMAKE_CXXFLAGS += -std=c++11 -O2
+
+INCLUDEPATH += ..
+
+SOURCES += ingest-bench.cpp \
+    ../ingest-reactor.cpp \
+    ../decode-pool.cpp \
+    ../framereader.cpp \
+    ../message.pb.cpp
+
+HEADERS += ../ingest-reactor.hh \
+    ../decode-pool.hh \
+    ../framereader.hh \
+    ../ringbuffer.hh \
+    ../libs/shm_ring.hh
+
+LIBS += `pkg-config --cflags --libs protobuf` -lprotobuf
+unix:!macx: LIBS += -lrt
@@ -0,0 +1,36 @@
+#!/bin/sh
+# Save/load round trip of an execution with restarts: streams a search
+# with restarts from synth-solver, saves it, loads it back and checks that
+# the loaded tree was built restart by restart in parallel and has as many
+# nodes as the original.
+#
+#   (from the build directory, with cp-profiler and synth-solver built)
+#   ../bench/restart-roundtrip.sh [restarts] [nodes]
+
+PROFILER=${PROFILER:-./cp-profiler}
+SOLVER=${SOLVER:-./synth-solver}
+RESTARTS=${1:-8}
+NODES=${2:-200000}
+
+FILE=$(mktemp)
+trap 'rm -f "$FILE" "$FILE.live" "$FILE.loaded"' EXIT
+
+"$PROFILER" --test --save_execution "$FILE" 2> "$FILE.live" &
+PID=$!
+sleep 1
+"$SOLVER" --nodes="$NODES" --restarts="$RESTARTS" --batch=1024 --delta || exit 1
+wait $PID
+
+"$PROFILER" --test --load "$FILE" 2> "$FILE.loaded"
+
+live=$(sed -n 's/^ingest: \([0-9]*\) nodes.*/\1/p' "$FILE.live")
+loaded=$(sed -n 's/^ingest: \([0-9]*\) nodes.*/\1/p' "$FILE.loaded")
+built=$(sed -n 's/^restarts built in parallel: \([0-9]*\)/\1/p' "$FILE.loaded")
+
+echo "live: $live nodes, loaded: $loaded nodes, restarts built in parallel: $built"
+if [ -n "$live" ] && [ "$live" = "$loaded" ] && [ "$built" = "$RESTARTS" ]; then
+  echo "PASS: restarts survive a save/load round trip"
+else
+  echo "FAIL: restarts survive a save/load round trip"
+  exit 1
+fi
@@ -0,0 +1,458 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/// Load generator standing in for a solver: synthesizes a search (or
+/// replays a saved execution) and streams it to the profiler over TCP with
+/// the usual length-prefixed frames, optionally at a fixed rate.
+///
+/// End-to-end ingest benchmark:
+///
+///   cp-profiler --test &
+///   synth-solver --nodes=5000000 --batch=1024 --delta
+///
+/// The profiler then prints nodes/s, receive-to-tree latency percentiles
+/// and its peak RSS, and exits.
+///
+/// options (defaults in brackets):
+///   --host=<addr> [127.0.0.1]    --port=<n> [6565]
+///   --nodes=<n> [1000000]        total, over all restarts
+///   --branching=<n> [2]          --depth=<n> [40]
+///   --fail=<ratio> [0.3]         chance of a node failing before max depth
+///   --restarts=<n> [0]           0: a single search without restarts
+///   --threads=<n> [1]            solver threads (thread_id of the nodes)
+///   --label_size=<n> [0]         pad labels to at least n characters
+///   --nogood_size=<n> [0]        nogood bytes on failed nodes (0: none)
+///   --nogood_ratio=<ratio> [0.5] share of failed nodes with a nogood
+///   --rate=<nodes/s> [0]         0: as fast as possible
+///   --batch=<n> [0]              send NODE_BATCH messages of n nodes
+///   --delta                      DELTA-encode the batches
+///   --replay=<file>              send a saved execution instead
+///   --seed=<n> [1]
+
+#include "../message.pb.hh"
+#include "../libs/delta_codec.hh"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <netdb.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using clock_type = std::chrono::steady_clock;
+
+struct Options {
+  std::string host = "127.0.0.1";
+  std::string port = "6565";
+  long long nodes = 1000000;
+  int branching = 2;
+  int depth = 40;
+  double fail = 0.3;
+  int restarts = 0;
+  int threads = 1;
+  int label_size = 0;
+  int nogood_size = 0;
+  double nogood_ratio = 0.5;
+  double rate = 0;
+  int batch = 0;
+  bool delta = false;
+  std::string replay;
+  unsigned seed = 1;
+
+  bool parse(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+      std::string arg = argv[i];
+      const auto eq = arg.find('=');
+      const std::string key = arg.substr(0, eq);
+      const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+      if (key == "--host") host = value;
+      else if (key == "--port") port = value;
+      else if (key == "--nodes") nodes = std::atoll(value.c_str());
+      else if (key == "--branching") branching = std::max(1, std::atoi(value.c_str()));
+      else if (key == "--depth") depth = std::atoi(value.c_str());
+      else if (key == "--fail") fail = std::atof(value.c_str());
+      else if (key == "--restarts") restarts = std::atoi(value.c_str());
+      else if (key == "--threads") threads = std::max(1, std::atoi(value.c_str()));
+      else if (key == "--label_size") label_size = std::atoi(value.c_str());
+      else if (key == "--nogood_size") nogood_size = std::atoi(value.c_str());
+      else if (key == "--nogood_ratio") nogood_ratio = std::atof(value.c_str());
+      else if (key == "--rate") rate = std::atof(value.c_str());
+      else if (key == "--batch") batch = std::atoi(value.c_str());
+      else if (key == "--delta") delta = true;
+      else if (key == "--replay") replay = value;
+      else if (key == "--seed") seed = std::atoi(value.c_str());
+      else {
+        std::cerr << "unknown option " << arg << "\n";
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+/// Writes frames to the profiler, buffering them and keeping to the rate
+class Emitter {
+  int _fd = -1;
+  const Options& _opt;
+  std::string _out;
+  std::string _body;
+
+  /// NODE_BATCH mode
+  message::Node _batch_msg;
+  message::Node _dict;
+  std::unordered_map<std::string, int> _labels;
+  delta_codec::Encoder<message::NodeBatch> _encoder;
+
+  clock_type::time_point _begin;
+  long long _sent = 0;
+
+  bool flushOut() {
+    size_t pos = 0;
+    while (pos < _out.size()) {
+      ssize_t n = ::send(_fd, _out.data() + pos, _out.size() - pos, MSG_NOSIGNAL);
+      if (n <= 0) return false;
+      pos += n;
+    }
+    _out.clear();
+    return true;
+  }
+
+  /// wait until `_sent` nodes are due
+  void pace() {
+    if (_opt.rate <= 0) return;
+    auto due = _begin + std::chrono::duration_cast<clock_type::duration>(
+                            std::chrono::duration<double>(_sent / _opt.rate));
+    if (due > clock_type::now()) {
+      flushOut();
+      std::this_thread::sleep_until(due);
+    }
+  }
+
+ public:
+  long long bytes = 0;
+
+  Emitter(const Options& opt) : _opt(opt) {
+    _batch_msg.set_type(message::Node::NODE_BATCH);
+    _dict.set_type(message::Node::LABEL_DICT);
+  }
+
+  ~Emitter() {
+    if (_fd >= 0) ::close(_fd);
+  }
+
+  bool connect() {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* res = nullptr;
+    if (getaddrinfo(_opt.host.c_str(), _opt.port.c_str(), &hints, &res) != 0)
+      return false;
+    for (auto ai = res; ai; ai = ai->ai_next) {
+      _fd = ::socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+      if (_fd < 0) continue;
+      if (::connect(_fd, ai->ai_addr, ai->ai_addrlen) == 0) break;
+      ::close(_fd);
+      _fd = -1;
+    }
+    freeaddrinfo(res);
+    _begin = clock_type::now();
+    return _fd >= 0;
+  }
+
+  bool frame(const message::Node& msg) {
+    msg.SerializeToString(&_body);
+    const uint32_t size = _body.size();
+    _out.append(reinterpret_cast<const char*>(&size), 4);
+    _out.append(_body);
+    bytes += 4 + size;
+    return _out.size() < (1 << 16) || flushOut();
+  }
+
+  /// a message of a replayed execution carrying `nodes` nodes
+  bool replayed(const message::Node& msg, int nodes) {
+    _sent += nodes;
+    pace();
+    return frame(msg);
+  }
+
+  bool node(const message::Node& node) {
+    if (_opt.batch <= 0) {
+      ++_sent;
+      pace();
+      return frame(node);
+    }
+
+    auto& batch = *_batch_msg.mutable_batch();
+    const int i = batch.sid_size();
+    batch.add_sid(node.sid());
+    batch.add_pid(node.pid());
+    batch.add_alt(node.alt());
+    batch.add_kids(node.kids());
+    batch.add_status(node.status());
+    batch.add_restart_id(node.restart_id());
+    batch.add_time(node.time());
+    batch.add_thread_id(node.thread_id());
+
+    auto it = _labels.find(node.label());
+    if (it == _labels.end()) {
+      if (_dict.labels_size() == 0) _dict.set_first_label_id(_labels.size());
+      it = _labels.emplace(node.label(), _labels.size()).first;
+      _dict.add_labels(node.label());
+    }
+    batch.add_label_id(it->second);
+
+    if (node.has_nogood()) {
+      batch.add_nogood_idx(i);
+      batch.add_nogood(node.nogood());
+    }
+
+    return batch.sid_size() < _opt.batch || flushBatch();
+  }
+
+  bool flushBatch() {
+    auto& batch = *_batch_msg.mutable_batch();
+    if (batch.sid_size() == 0) return true;
+
+    if (_dict.labels_size() > 0) {
+      if (!frame(_dict)) return false;
+      _dict.clear_labels();
+    }
+    if (_opt.delta) _encoder.encode(batch);
+    _sent += std::max(batch.sid_size(), batch.sid_delta_size());
+    pace();
+    const bool ok = frame(_batch_msg);
+    batch.Clear();
+    return ok;
+  }
+
+  bool finish() {
+    message::Node done;
+    done.set_type(message::Node::DONE);
+    return flushBatch() && frame(done) && flushOut();
+  }
+
+  long long sent() const { return _sent; }
+};
+
+/// An open branch: the `alt`-th child of `pid`, at depth `depth`
+struct Open {
+  int pid;
+  int alt;
+  int depth;
+};
+
+class Generator {
+  const Options& _opt;
+  std::mt19937 _rng;
+  std::uniform_real_distribution<double> _uniform{0.0, 1.0};
+  message::Node _node;
+
+  std::string label(int alt) {
+    const int var = _rng() % 100;
+    const int val = _rng() % 10;
+    std::string name = "x";
+    std::string rest = "[" + std::to_string(var) + "]" + (alt == 0 ? "=" : "!=") +
+                       std::to_string(val);
+    if (static_cast<int>(name.size() + rest.size()) < _opt.label_size) {
+      name.append(_opt.label_size - name.size() - rest.size(), '_');
+    }
+    return name + rest;
+  }
+
+  std::string nogood() {
+    std::string ng;
+    while (static_cast<int>(ng.size()) < _opt.nogood_size) {
+      if (!ng.empty()) ng += " \\/ ";
+      ng += "x[" + std::to_string(_rng() % 100) + "]!=" + std::to_string(_rng() % 10);
+    }
+    return ng;
+  }
+
+ public:
+  explicit Generator(const Options& opt) : _opt(opt), _rng(opt.seed) {}
+
+  /// One search tree (restart `restart_id`) of at most `budget` nodes
+  bool search(Emitter& out, int restart_id, long long budget) {
+    std::vector<std::vector<Open>> stacks(_opt.threads);
+    std::vector<unsigned long long> clock(_opt.threads, 0);
+    stacks[0].push_back(Open{-1, 0, 0});
+    long long open_branches = 1;
+    int next_sid = 0;
+    int t = 0;
+
+    for (long long n = 0; n < budget; ++n, t = (t + 1) % _opt.threads) {
+      if (stacks[t].empty()) {
+        // steal the oldest branch of the busiest thread
+        auto victim = std::max_element(
+            stacks.begin(), stacks.end(),
+            [](const std::vector<Open>& a, const std::vector<Open>& b) {
+              return a.size() < b.size();
+            });
+        if (victim->empty()) return true;  // the tree is complete
+        stacks[t].push_back(victim->front());
+        victim->erase(victim->begin());
+      }
+
+      Open open = stacks[t].back();
+      stacks[t].pop_back();
+      --open_branches;
+
+      _node.Clear();
+      _node.set_type(message::Node::NODE);
+      _node.set_sid(next_sid++);
+      _node.set_pid(open.pid);
+      _node.set_alt(open.alt);
+      _node.set_restart_id(_opt.restarts > 0 ? restart_id : -1);
+      _node.set_thread_id(t);
+      _node.set_time(clock[t] += 1 + _rng() % 50);
+      if (open.pid != -1) _node.set_label(label(open.alt));
+
+      int kids = 0;
+      if (open.depth >= _opt.depth) {
+        _node.set_status(_uniform(_rng) < 0.01 ? message::Node::SOLVED
+                                               : message::Node::FAILED);
+      } else if (open_branches > 0 && _uniform(_rng) < _opt.fail) {
+        // (the last open branch never fails, so that the search does not
+        // end long before the node budget)
+        _node.set_status(message::Node::FAILED);
+      } else {
+        _node.set_status(message::Node::BRANCH);
+        kids = _opt.branching;
+      }
+      _node.set_kids(kids);
+
+      if (_node.status() == message::Node::FAILED && _opt.nogood_size > 0 &&
+          _uniform(_rng) < _opt.nogood_ratio) {
+        _node.set_nogood(nogood());
+      }
+
+      for (int k = kids - 1; k >= 0; --k) {
+        stacks[t].push_back(Open{_node.sid(), k, open.depth + 1});
+      }
+      open_branches += kids;
+
+      if (!out.node(_node)) return false;
+    }
+    return true;
+  }
+
+  bool run(Emitter& out) {
+    message::Node start;
+    start.set_type(message::Node::START);
+    start.set_label("synthetic search");
+    start.set_restart_id(_opt.restarts > 0 ? 0 : -1);
+    if (_opt.delta) start.set_encoding(message::Node::DELTA);
+    if (!out.frame(start)) return false;
+
+    const int searches = std::max(_opt.restarts, 1);
+    for (int r = 0; r < searches; ++r) {
+      if (r > 0) {
+        if (!out.flushBatch()) return false;
+        start.set_restart_id(r);
+        if (!out.frame(start)) return false;
+      }
+      const long long budget = _opt.nodes / searches +
+                               (r < _opt.nodes % searches ? 1 : 0);
+      if (!search(out, r, budget)) return false;
+    }
+    return out.finish();
+  }
+};
+
+/// Read one varint-delimited message, as written by "Save execution"
+static bool readDelimited(google::protobuf::io::ZeroCopyInputStream* raw,
+                          message::Node* msg) {
+  google::protobuf::io::CodedInputStream input(raw);
+  uint32_t size;
+  if (!input.ReadVarint32(&size)) return false;
+  auto limit = input.PushLimit(size);
+  if (!msg->ParseFromCodedStream(&input) || !input.ConsumedEntireMessage())
+    return false;
+  input.PopLimit(limit);
+  return true;
+}
+
+static bool replay(const Options& opt, Emitter& out) {
+  std::ifstream file(opt.replay, std::ios::in | std::ios::binary);
+  if (!file) {
+    std::cerr << "can't open " << opt.replay << "\n";
+    return false;
+  }
+  google::protobuf::io::IstreamInputStream raw(&file);
+
+  message::Node msg;
+  bool first = true;
+  while (readDelimited(&raw, &msg)) {
+    if (first && msg.type() != message::Node::START) {
+      // files saved before v0.6 start with the nodes
+      message::Node start;
+      start.set_type(message::Node::START);
+      start.set_label("replay of " + opt.replay);
+      if (!out.frame(start)) return false;
+    }
+    first = false;
+
+    int nodes = 0;
+    if (msg.type() == message::Node::NODE) nodes = 1;
+    if (msg.type() == message::Node::NODE_BATCH) {
+      nodes = std::max(msg.batch().sid_size(), msg.batch().sid_delta_size());
+    }
+    if (!out.replayed(msg, nodes)) return false;
+  }
+  return out.finish();
+}
+
+int main(int argc, char* argv[]) {
+  Options opt;
+  if (!opt.parse(argc, argv)) return 2;
+
+  Emitter out(opt);
+  if (!out.connect()) {
+    std::cerr << "can't connect to " << opt.host << ":" << opt.port << "\n";
+    return 1;
+  }
+
+  const auto begin = clock_type::now();
+  const bool ok = opt.replay.empty() ? Generator(opt).run(out) : replay(opt, out);
+  const double seconds =
+      std::chrono::duration<double>(clock_type::now() - begin).count();
+
+  std::cout << "sent " << out.sent() << " nodes (" << out.bytes << " bytes) in "
+            << seconds << " s: " << static_cast<long long>(out.sent() / seconds)
+            << " nodes/s, " << static_cast<double>(out.bytes) / out.sent()
+            << " bytes/node\n";
+  if (!ok) std::cerr << "connection lost\n";
+  return ok ? 0 : 1;
+}
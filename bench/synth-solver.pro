@@ -0,0 +1,21 @@
+# Synthetic solver: streams generated (or saved) searches to the profiler
+#
+#   mkdir build-bench && cd build-bench
+#   qmake ../bench/synth-solver.pro && make
+#   cp-profiler --test & ./synth-solver --nodes=5000000 --batch=1024
+
+TEMPLATE = app
+TARGET = synth-solver
+CONFIG += console
+CONFIG -= qt app_bundle
+
+QMAKE_CXXFLAGS += -std=c++11 -O2
+
+INCLUDEPATH += ..
+
+SOURCES += synth-solver.cpp \
+    ../message.pb.cpp
+
+HEADERS += ../libs/delta_codec.hh
+
+LIBS += `pkg-config --cflags --libs protobuf` -lprotobuf
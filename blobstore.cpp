@@ -0,0 +1,130 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "blobstore.hh"
+#include "mappedstore.hh"
+
+#include <algorithm>
+#include <cstring>
+
+void BlobStore::setCompression(bool compress) {
+    QMutexLocker locker(&_mutex);
+    _compress = compress;
+}
+
+void BlobStore::seal() {
+    Block block;
+    block.data = QByteArray(_open.data(), static_cast<int>(_open.size()));
+    block.compressed = false;
+
+    if (_compress) {
+        /// keep the compressed bytes only if they are worth it
+        QByteArray packed = qCompress(block.data);
+        if (packed.size() < block.data.size() - block.data.size() / 8) {
+            block.data = std::move(packed);
+            block.compressed = true;
+        }
+    }
+    if (_store) {
+        char* p = _store->allocate(block.data.size());
+        std::memcpy(p, block.data.constData(), block.data.size());
+        _store->seal(p, block.data.size());
+        block.data = QByteArray::fromRawData(p, block.data.size());
+    } else {
+        block.data.squeeze();
+    }
+
+    _blocks.push_back(std::move(block));
+    _block_starts.push_back(_open_start);
+
+    _open_start += _open.size();
+    _open.clear();
+}
+
+void BlobStore::add(int64_t full_sid, const std::string& blob) {
+    QMutexLocker locker(&_mutex);
+
+    /// a string never spans blocks; a long one gets a block of its own
+    if (!_open.empty() && _open.size() + blob.size() > BLOCK_BYTES) {
+        seal();
+    }
+
+    _index.insert(full_sid, static_cast<int>(_offsets.size()));
+    _offsets.push_back(_open_start + _open.size());
+    _open += blob;
+}
+
+const QByteArray& BlobStore::raw(int b) const {
+    const Block& block = _blocks[b];
+    if (!block.compressed) return block.data;
+
+    if (_cached_block != b) {
+        _cached = qUncompress(block.data);
+        _cached_block = b;
+    }
+    return _cached;
+}
+
+bool BlobStore::contains(int64_t full_sid) const {
+    QMutexLocker locker(&_mutex);
+    return _index.find(full_sid) != -1;
+}
+
+std::string BlobStore::get(int64_t full_sid) const {
+    QMutexLocker locker(&_mutex);
+
+    const int n = _index.find(full_sid);
+    if (n == -1) return std::string();
+
+    const uint64_t begin = _offsets[n];
+    const uint64_t end = n + 1 < static_cast<int>(_offsets.size())
+        ? _offsets[n + 1] : _open_start + _open.size();
+
+    if (begin >= _open_start) {
+        return _open.substr(begin - _open_start, end - begin);
+    }
+
+    const int b = static_cast<int>(
+        std::upper_bound(_block_starts.begin(), _block_starts.end(), begin) -
+        _block_starts.begin()) - 1;
+    const QByteArray& data = raw(b);
+    return std::string(data.constData() + (begin - _block_starts[b]), end - begin);
+}
+
+int BlobStore::size() const {
+    QMutexLocker locker(&_mutex);
+    return static_cast<int>(_offsets.size());
+}
+
+size_t BlobStore::bytes() const {
+    QMutexLocker locker(&_mutex);
+    size_t total = _open.capacity() + _index.bytes() +
+        _offsets.capacity() * sizeof(uint64_t) +
+        _blocks.capacity() * sizeof(Block) +
+        _block_starts.capacity() * sizeof(uint64_t);
+    for (const auto& block : _blocks) total += block.data.size();
+    return total;
+}
+
+size_t BlobStore::rawBytes() const {
+    QMutexLocker locker(&_mutex);
+    return _open_start + _open.size();
+}
@@ -0,0 +1,116 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef BLOB_STORE_HH
+#define BLOB_STORE_HH
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <QByteArray>
+#include <QMutex>
+
+#include "sidindex.hh"
+
+class MappedStore;
+
+/// Nogood / info strings by full solver id.
+///
+/// The strings are appended to blocks of about BLOCK_BYTES; every string
+/// gets a number (through a SidIndex) and the number an offset, so a
+/// string costs its bytes plus a 4-byte slot and an 8-byte offset (with
+/// vector slack, about 15 bytes for a nogood on every node, whatever the
+/// restart_id) instead of a hash map node and a heap allocation.  Full
+/// blocks can be compressed; lookups decompress them (the last one is
+/// kept).  Full blocks go to a MappedStore if one is given.
+///
+/// Strings are added by the receiving thread and looked up by the GUI,
+/// so every call takes a lock.
+class BlobStore {
+public:
+    static constexpr int BLOCK_BYTES = 64 << 10;
+
+    explicit BlobStore(MappedStore* store = nullptr, bool compress = false)
+        : _store(store), _compress(compress) {}
+
+    BlobStore(const BlobStore&) = delete;
+    BlobStore& operator=(const BlobStore&) = delete;
+
+    /// Whether to compress full blocks (the ones filled from now on)
+    void setCompression(bool compress);
+
+    /// Set the string of `full_sid` (replacing the previous one)
+    void add(int64_t full_sid, const std::string& blob);
+
+    bool contains(int64_t full_sid) const;
+
+    /// The string of `full_sid`, empty if there is none
+    std::string get(int64_t full_sid) const;
+
+    /// Number of strings added
+    int size() const;
+
+    /// Bytes taken by the blocks and the index
+    size_t bytes() const;
+
+    /// Bytes of the strings as they were added
+    size_t rawBytes() const;
+
+private:
+    struct Block {
+        /// qCompress'ed if `compressed`; refers to the MappedStore's
+        /// memory if there is one
+        QByteArray data;
+        bool compressed;
+    };
+
+    mutable QMutex _mutex;
+
+    MappedStore* _store;
+    bool _compress;
+
+    /// full sid -> string number
+    SidIndex _index;
+
+    /// where every string starts, counting the raw bytes of all blocks;
+    /// a string ends where the next one starts (or at the end of `_open`)
+    std::vector<uint64_t> _offsets;
+
+    std::vector<Block> _blocks;
+    /// where every block starts (as in `_offsets`)
+    std::vector<uint64_t> _block_starts;
+
+    /// the block being filled
+    std::string _open;
+    uint64_t _open_start = 0;
+
+    /// the last block decompressed
+    mutable int _cached_block = -1;
+    mutable QByteArray _cached;
+
+    void seal();
+
+    /// the raw bytes of block `b` (a sealed one)
+    const QByteArray& raw(int b) const;
+};
+
+#endif
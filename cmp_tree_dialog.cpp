@@ -219,21 +219,9 @@ CmpTreeDialog::showPentagonHist() {
 }
 
 
-static string empty_string = "";
-
-// string& getNogoodById(int ng_id, const Execution& e) {
-string& getNogoodById(int ng_id, const std::unordered_map<int64_t, string>& ng_map) {
-
-
-  string& nogood = empty_string;
-
-  auto maybe_nogood = ng_map.find(ng_id);
-
-  if (maybe_nogood != ng_map.end()){
-    nogood = maybe_nogood->second;
-  }
-
-  return nogood;
+// string getNogoodById(int ng_id, const Execution& e) {
+string getNogoodById(int ng_id, const BlobStore& ng_map) {
+  return ng_map.get(ng_id);
 }
 
 void
@@ -244,7 +232,7 @@ CmpTreeDialog::saveComparisonStatsTo(const QString& file_name) {
             QTextStream out(&outputFile);
 
             auto ng_stats = comparison_->responsible_nogood_stats();
-            auto nogood_map = comparison_->left_execution().getNogoods();
+            const auto& nogood_map = comparison_->left_execution().getNogoods();
 
             out << "id,occur,score,nogood\n";
 
@@ -254,7 +242,7 @@ CmpTreeDialog::saveComparisonStatsTo(const QString& file_name) {
               out << ng.second.occurrence << ",";
               out << ng.second.search_eliminated << ",";
 
-              string& nogood = getNogoodById(ng.first, nogood_map);
+              string nogood = getNogoodById(ng.first, nogood_map);
 
               out << nogood.c_str() << "\n";
             }
@@ -305,7 +293,7 @@ void
 PentListWindow::populateNogoodTable(const vector<int>& nogoods) {
 
   auto ng_stats = comparison_.responsible_nogood_stats();
-  auto nogood_map = comparison_.left_execution().getNogoods();
+  const auto& nogood_map = comparison_.left_execution().getNogoods();
 
   _nogoodTable.setRowCount(nogoods.size());
 
@@ -314,7 +302,7 @@ PentListWindow::populateNogoodTable(const vector<int>& nogoods) {
     int ng_id = nogoods[i]; /// is this sid of gid???
     _nogoodTable.setItem(i, 0, new QTableWidgetItem(QString::number(ng_id)));
 
-    string& nogood = getNogoodById(ng_id, nogood_map);
+    string nogood = getNogoodById(ng_id, nogood_map);
 
     int ng_count = ng_stats.at(ng_id).occurrence;
 
@@ -338,13 +326,13 @@ PentListWindow::PentListWindow(CmpTreeDialog* parent, const std::vector<Pentagon
   connect(&_pentagonTable, &QTableWidget::cellDoubleClicked, [this, parent](int row, int) {
     static_cast<CmpTreeDialog*>(parent)->selectPentagon(row);
 
-    auto maybe_info = _items[row].info;
+    const auto& maybe_info = _items[row].info;
 
     /// clear nogood view
     _nogoodTable.clearContents();
 
-    if (maybe_info) {
-      auto nogoods = infoToNogoodVector(*maybe_info);
+    if (!maybe_info.empty()) {
+      auto nogoods = infoToNogoodVector(maybe_info);
 
       populateNogoodTable(nogoods);
     }
@@ -399,10 +387,10 @@ PentListWindow::createList()
     _pentagonTable.setItem(i, 0, new QTableWidgetItem(QString::number(_items[i].l_size)));
     _pentagonTable.setItem(i, 1, new QTableWidgetItem(QString::number(_items[i].r_size)));
 
-    auto maybe_info = _items[i].info;
-    if (maybe_info) {
+    const auto& maybe_info = _items[i].info;
+    if (!maybe_info.empty()) {
 
-     QString nogood_str = infoToNogoodStr(*maybe_info);
+     QString nogood_str = infoToNogoodStr(maybe_info);
 
       _pentagonTable.setItem(i, 2, new QTableWidgetItem(nogood_str));
     }
@@ -475,7 +463,7 @@ CmpTreeDialog::showResponsibleNogoods() {
 
   ng_table->setRowCount(ng_stats.size());
 
-  auto nogood_map = comparison_->left_execution().getNogoods();
+  const auto& nogood_map = comparison_->left_execution().getNogoods();
 
   int row = 0;
   for (auto ng : ng_stats_vector) {
@@ -483,7 +471,7 @@ CmpTreeDialog::showResponsibleNogoods() {
     ng_table->setItem(row, 0, new QTableWidgetItem(QString::number(ng.first)));
     ng_table->setItem(row, 1, new QTableWidgetItem(QString::number(ng.second.occurrence)));
 
-    string& nogood = getNogoodById(ng.first, nogood_map);
+    string nogood = getNogoodById(ng.first, nogood_map);
 
     ng_table->setItem(row, 2, new QTableWidgetItem(QString::number(ng.second.search_eliminated)));
     ng_table->setItem(row, 3, new QTableWidgetItem(nogood.c_str()));
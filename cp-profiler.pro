@@ -45,8 +45,17 @@ SOURCES += main.cpp\
     spacenode.cpp \
     node.cpp \
     data.cpp \
+    entrycolumns.cpp \
+    sidindex.cpp \
+    mappedstore.cpp \
+    blobstore.cpp \
+    gidindex.cpp \
+    labeltable.cpp \
     cmp_tree_dialog.cpp \
-    receiverthread.cpp \
+    receiver.cpp \
+    ingest-reactor.cpp \
+    decode-pool.cpp \
+    framereader.cpp \
     treebuilder.cpp \
     readingQueue.cpp \
     treecomparison.cpp \
@@ -57,6 +66,7 @@ SOURCES += main.cpp\
     message.pb.cpp \
     profiler-conductor.cpp \
     profiler-tcp-server.cpp \
+    profiler-local-server.cpp \
     ml-stats.cpp \
     execution.cpp \
     cpprofiler\analysis\backjumps.cpp \
@@ -91,9 +101,21 @@ HEADERS  += globalhelper.hh \
     nodevisitor.hpp \
     zoomToFitIcon.hpp \
     data.hh \
+    entrycolumns.hh \
+    sidindex.hh \
+    memoryusage.hh \
+    mappedstore.hh \
+    blobstore.hh \
+    gidindex.hh \
+    labeltable.hh \
     highlight_nodes_dialog.hpp \
     cmp_tree_dialog.hh \
-    receiverthread.hh \
+    receiver.hh \
+    ingest-reactor.hh \
+    decode-pool.hh \
+    ringbuffer.hh \
+    spscqueue.hh \
+    framereader.hh \
     treebuilder.hh \
     readingQueue.hh \
     treecomparison.hh \
@@ -102,6 +124,9 @@ HEADERS  += globalhelper.hh \
     message.pb.hh \
     profiler-conductor.hh \
     profiler-tcp-server.hh \
+    profiler-local-server.hh \
+    libs/shm_ring.hh \
+    libs/local_connector.hh \
     execution.hh \
     cpprofiler\pixeltree\pixelImage.hh \
     maybeCaller.hh \
@@ -124,6 +149,9 @@ win32:CONFIG(release, debug|release): LIBS += -L$$PWD/../../../../../../../usr/l
 else:win32:CONFIG(debug, debug|release): LIBS += -L$$PWD/../../../../../../../usr/local/lib/debug/
 else:unix: LIBS += -L$$PWD/../../../../../../usr/local/lib/ -ldl
 
+# shm_open/shm_unlink for the shared memory transport
+unix:!macx: LIBS += -lrt
+
 INCLUDEPATH += /usr/local/include
 
 LIBS += `pkg-config --cflags --libs protobuf` -lprotobuf
@@ -267,8 +267,8 @@ QRgb IcicleTreeCanvas::getColorByType(const SpaceNode& node) {
   auto& na = tc_.getExecution()->getNA();
   auto data = tc_.getExecution()->getData();
   auto gid = node.getIndex(na);
-  auto* entry = data->getEntry(gid);
-  auto domain_red = entry == nullptr ? 0 : entry->domain;
+  auto entry = data->getEntry(gid);
+  auto domain_red = !entry ? 0 : entry.domain();
   domain_red_sum += domain_red;
   switch (IcicleTreeCanvas::color_mapping_type) {
     case ColorMappingType::DEFAULT: {
@@ -282,7 +282,7 @@ QRgb IcicleTreeCanvas::getColorByType(const SpaceNode& node) {
       color = QColor::fromHsv(0, 0, color_value).rgba();
     } break;
     case ColorMappingType::NODE_TIME: {
-      auto node_time = entry == nullptr ? 0 : entry->node_time;
+      auto node_time = !entry ? 0 : entry.node_time();
       /// TODO(maxim): need to normalize the node time
       int color_value = static_cast<float>(node_time);
       color = QColor::fromHsv(0, 0, color_value).rgba();
@@ -253,4 +253,11 @@ void PixelImage::scaleUp() { scalePixelBy(1); }
 
 const QImage* PixelImage::image() { return image_; }
 
+size_t PixelImage::bytes() const {
+  /// image_ draws from result_buffer_
+  return sizeof(uint32) *
+         (buffer_.capacity() + background_buffer_.capacity() +
+          guidlines_buffer_.capacity() + result_buffer_.capacity());
+}
+
 PixelImage::~PixelImage() { delete image_; }
\ No newline at end of file
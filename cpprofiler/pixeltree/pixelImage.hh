@@ -93,6 +93,9 @@ class PixelImage {
   int height() { return height_ / pixel_height_; }
 
   const QImage* image();
+
+  /// Bytes of the buffers
+  size_t bytes() const;
   /// TODO(maxim): change the name (and have a second method for width)
   int pixel_height() const { return pixel_height_; };
   int pixel_width() const { return pixel_width_; };
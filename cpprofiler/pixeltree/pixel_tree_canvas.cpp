@@ -27,6 +27,7 @@
 #include "cpprofiler/analysis/backjumps.hh"
 #include "libs/perf_helper.hh"
 #include "data.hh"
+#include "execution.hh"
 
 using namespace cpprofiler::pixeltree;
 using std::chrono::high_resolution_clock;
@@ -49,6 +50,7 @@ using std::list;
 PixelTreeCanvas::PixelTreeCanvas(QWidget* parent, TreeCanvas& tc)
     : QWidget(parent),
       _tc(tc),
+      _execution(tc.getExecution()),
       _data(*tc.getExecution()->getData()),
       _na(tc.getExecution()->getNA()),
       depthAnalysis(tc) {
@@ -180,7 +182,7 @@ void PixelTreeCanvas::compressTimeHistogram(vector<float>& compressed,
     group_count++;
 
     auto entry = _data.getEntry(pixel_list[i].node()->getIndex(_na));
-    auto value = (entry == nullptr) ? 0 : entry->node_time;
+    auto value = !entry ? 0 : entry.node_time();
     group_value += value;
 
     if (group_count == compression) {
@@ -215,7 +217,7 @@ void PixelTreeCanvas::getDomainDataCompressed(vector<float>& compressed,
     group_count++;
 
     auto entry = _data.getEntry(pixel_list[i].node()->getIndex(_na));
-    auto value = (entry == nullptr) ? 0 : entry->domain;
+    auto value = !entry ? 0 : entry.domain();
     group_value += value;
 
     if (group_count == compression) {
@@ -306,13 +308,12 @@ void PixelTreeCanvas::gatherNogoodData() {
   auto data_length = pixel_data.pixel_list.size();
   nogood_counts.resize(data_length);
 
-  auto sid2nogood = _data.getNogoods();
+  const auto& sid2nogood = _data.getNogoods();
 
   for (unsigned i = 0; i < data_length; i++) {
     auto node = pixel_data.pixel_list[i].node();
-    auto it = sid2nogood.find(node->getIndex(_na));
-    if (it != sid2nogood.end()) {
-      auto nogood = it->second;
+    auto nogood = sid2nogood.get(node->getIndex(_na));
+    if (!nogood.empty()) {
       // qDebug() << "nogood: " << nogood.c_str();
       /// work out var length
       auto count = 0;
@@ -556,9 +557,36 @@ void PixelTreeCanvas::redrawAll() {
   pixel_image.update();
   perfHelper.end();
 
+  if (_execution) _execution->setViewBytes(this, bytes());
+
   repaint();
 }
 
+PixelTreeCanvas::~PixelTreeCanvas() {
+  if (_execution) _execution->setViewBytes(this, 0);
+}
+
+template <typename T>
+static size_t vectorBytes(const std::vector<T>& v) {
+  return v.capacity() * sizeof(T);
+}
+
+template <typename T>
+static size_t vectorBytes(const std::vector<std::vector<T>>& v) {
+  size_t total = v.capacity() * sizeof(v[0]);
+  for (const auto& row : v) total += vectorBytes(row);
+  return total;
+}
+
+size_t PixelTreeCanvas::bytes() const {
+  return pixel_image.bytes() + vectorBytes(pixel_data.pixel_list) +
+         vectorBytes(time_arr) + vectorBytes(domain_arr) +
+         vectorBytes(domain_red_arr) + vectorBytes(var_decisions) +
+         vectorBytes(var_decisions_compressed) + vectorBytes(nogood_counts) +
+         vectorBytes(nogood_counts_compressed) + vectorBytes(da_data) +
+         vectorBytes(da_data_compressed);
+}
+
 void PixelTreeCanvas::drawVarData() {
   /// TODO: add flush
 
@@ -680,8 +708,8 @@ void PixelTreeCanvas::drawHistogram(vector<float>& data, int color) {
 }
 
 void PixelTreeCanvas::drawNodeRate(unsigned l_vline, unsigned r_vline) {
-  // std::vector<float>& node_rate = _data.node_rate;
-  std::vector<int>& nr_intervals = _data.nr_intervals;
+  // const std::vector<float> node_rate = _data.nodeRate();
+  const std::vector<int> nr_intervals = _data.nodeRateIntervals();
 
   // int start_x = 0;
 
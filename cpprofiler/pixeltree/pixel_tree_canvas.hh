@@ -23,6 +23,7 @@
 #ifndef CPPROFILER_PIXELTREE_CANVAS_HH
 #define CPPROFILER_PIXELTREE_CANVAS_HH
 
+#include <QPointer>
 #include <QWidget>
 #include <vector>
 #include <string>
@@ -34,6 +35,7 @@
 #include "maybeCaller.hh"
 
 class Data;
+class Execution;
 class TreeCanvas;
 
 class VisualNode;
@@ -81,6 +83,8 @@ class PixelTreeCanvas : public QWidget {
 
  private:
   TreeCanvas& _tc;
+  /// null once the execution is deleted
+  QPointer<Execution> _execution;
   Data& _data;
   NodeAllocator& _na;
   QPixmap pixmap;
@@ -182,8 +186,12 @@ class PixelTreeCanvas : public QWidget {
 
   PixelItem& gid2PixelItem(int gid);
 
+  /// Bytes of the image and of the data drawn (see Execution::memoryUsage)
+  size_t bytes() const;
+
  public:
   PixelTreeCanvas(QWidget* parent, TreeCanvas& tc);
+  ~PixelTreeCanvas();
 
  protected:
   void paintEvent(QPaintEvent* event);
@@ -19,13 +19,16 @@
  */
 #include "data.hh"
 
+#include <algorithm>
 #include <iostream>
 #include <qdebug.h>
 #include <string>
 #include <sstream>
 #include <QString>
+#include <QDir>
 #include <ctime>
 
+#include "globalhelper.hh"
 #include "visualnode.hh"
 #include "message.pb.hh"
 
@@ -34,29 +37,45 @@ using namespace std::chrono;
 
 int Data::instance_counter = 0;
 
+LabelTable& Data::labels() {
+    static LabelTable table;
+    return table;
+}
+
 ostream& operator<<(ostream& s, const DbEntry& e) {
     s << "dbEntry: {";
-    s << " sid: "  << e.restart_id << '_' << e.s_node_id;
-    s << " gid: "  << e.gid;
-    s << " pid: "  << e.restart_id << '_' << (int)e.parent_sid;
-    s << " alt: "  << e.alt;
-    s << " kids: " << e.numberOfKids;
-    s << " tid: "  << e.thread_id;
-    s << " restart: " << e.restart_id;
+    s << " sid: "  << e.restart_id() << '_' << e.s_node_id();
+    s << " gid: "  << e.gid();
+    s << " pid: "  << e.restart_id() << '_' << (int)e.parent_sid();
+    s << " alt: "  << e.alt();
+    s << " kids: " << e.numberOfKids();
+    s << " tid: "  << e.thread_id();
+    s << " restart: " << e.restart_id();
     s << " }";
     return s;
 }
 
 
-Data::Data() {
+Data::Data()
+    : columns(&store), sid2nogood(&store), entry_queue(QUEUE_BATCHES),
+      sid2info(&store) {
     _isDone = false;
     _prev_node_timestamp = 0;
     _time_per_node = -1; // unassigned
 
-    begin_time = system_clock::now();
-    current_time = begin_time;
-    last_interval_time = begin_time;
-    last_interval_nc = 0;
+    receive_time = steady_clock::now();
+    node_time_stamp = receive_time;
+
+    const size_t budget_mb =
+        std::max(GlobalParser::value(GlobalParser::memory_budget).toLongLong(), 0ll);
+    QString spill_dir = GlobalParser::value(GlobalParser::spill_dir);
+    if (spill_dir.isEmpty()) spill_dir = QDir::tempPath();
+    store.configure(budget_mb << 20, spill_dir.toStdString());
+
+    if (GlobalParser::isSet(GlobalParser::compress_payloads)) {
+        sid2nogood.setCompression(true);
+        sid2info.setCompression(true);
+    }
 
     // if (_tc->canvasType == CanvasType::MERGED) {
     //     _isDone = true;
@@ -69,8 +88,11 @@ void Data::setDoneReceiving(void) {
     std::cerr << "Data::setDoneReceiving\n";
     QMutexLocker locker(&dataMutex);
 
-    // _total_nodes = nodes_arr.size();
-    _total_time = nodes_arr.back()->time_stamp;
+    /// the columns belong to the builder, which may still be catching up
+    const int received = receivedCount();
+
+    // _total_nodes = columns.size();
+    _total_time = _prev_node_timestamp;
 
     if (_total_time != 0) {
         _time_per_node = _total_time / _total_time;
@@ -79,29 +101,66 @@ void Data::setDoneReceiving(void) {
     }
 
     /// *** Flush_node_rate ***
+    {
+        QMutexLocker rate_locker(&rate_mutex);
+        rate_samples.push_back({received, steady_clock::now()});
+        rate_closed = true;
+    }
 
-    current_time = system_clock::now();
-    long long time_passed = static_cast<long long>(
-        duration_cast<microseconds>(current_time - last_interval_time).count());
+    _isDone = true;
 
-    float nr = (nodes_arr.size() - last_interval_nc) * (float)NODE_RATE_STEP / time_passed;
-    node_rate.push_back(nr);
-    nr_intervals.push_back(last_interval_nc);
-    nr_intervals.push_back(nodes_arr.size());
+    wakeBuilder();
+}
 
-    _isDone = true;
 
+void Data::stampReceived(steady_clock::time_point when) {
+    receive_time = when;
+
+    QMutexLocker locker(&rate_mutex);
+    if (rate_closed) return;
+    if (!rate_samples.empty() &&
+        when - rate_samples.back().time < microseconds(NODE_RATE_STEP)) return;
+    rate_samples.push_back({receivedCount(), when});
 }
 
+long long Data::takeNodeTime() {
+    if (receive_time == node_time_stamp) return 0;
 
-int Data::handleNodeCallback(message::Node& node) {
+    auto prev_stamp = node_time_stamp;
+    node_time_stamp = receive_time;
+
+    if (receivedCount() == 0) return 0; /// ignore the first node
+
+    return duration_cast<microseconds>(receive_time - prev_stamp).count();
+}
+
+std::vector<int> Data::nodeRateIntervals() const {
+    QMutexLocker locker(&rate_mutex);
+
+    std::vector<int> intervals;
+    intervals.reserve(rate_samples.size() + 1);
+    for (const auto& sample : rate_samples) intervals.push_back(sample.received);
+    if (!rate_closed) intervals.push_back(receivedCount());
+    return intervals;
+}
+
+std::vector<float> Data::nodeRate() const {
+    QMutexLocker locker(&rate_mutex);
 
-    auto prev_node_time = current_time;
-    current_time = system_clock::now();
+    std::vector<float> rate;
+    for (size_t i = 1; i < rate_samples.size(); ++i) {
+        const auto& from = rate_samples[i - 1];
+        const auto& to = rate_samples[i];
+        auto time_passed = duration_cast<microseconds>(to.time - from.time).count();
+        rate.push_back(time_passed <= 0 ? 0.0f
+            : (to.received - from.received) * (float)NODE_RATE_STEP / time_passed);
+    }
+    return rate;
+}
 
-    auto node_time = duration_cast<microseconds>(current_time - prev_node_time).count();
+int Data::handleNodeCallback(message::Node& node) {
 
-    if (nodes_arr.size() == 0) node_time = 0; /// ignore the first node
+    auto node_time = takeNodeTime();
 
     int sid = node.sid();
     int pid = node.pid();
@@ -116,83 +175,156 @@ int Data::handleNodeCallback(message::Node& node) {
     int backjump_distance = node.backjump_distance();
     int decision_level = node.decision_level();
 
-    if (node.has_info() && node.info().length() > 0) {
-
-        sid2info[sid] = new std::string(node.info());
-    }
-
     /// thread id and node id are stored in one variable (for hashing)
     int64_t real_pid = -1;
     if (pid != -1) {
         real_pid = (pid | ((int64_t)restart_id << 32));
     }
 
-    const std::string& label = node.label();
-
+    int label_id = node.has_label_id() ? wireLabel(node.label_id())
+                                       : labels().intern(node.label());
+
+    outgoing.entries.emplace_back(sid,
+                                  restart_id,
+                                  real_pid,
+                                  alt,
+                                  kids,
+                                  label_id,
+                                  tid,
+                                  status,
+                                  node.time(),
+                                  node_time,
+                                  domain,
+                                  nogood_bld,
+                                  usesAssumptions,
+                                  backjump_distance,
+                                  decision_level);
 
-    auto entry = new DbEntry(sid,
-                    restart_id,
-                    real_pid,
-                    alt,
-                    kids,
-                    label,
-                    tid,
-                    status,
-                    node.time(),
-                    node_time,
-                    domain,
-                    nogood_bld,
-                    usesAssumptions,
-                    backjump_distance,
-                    decision_level);
-
-    pushInstance(entry);
+    if (node.has_info() && node.info().length() > 0) {
+        sid2info.add(outgoing.entries.back().full_sid, node.info());
+    }
 
     if (node.has_nogood() && node.nogood().length() > 0) {
         // qDebug() << "(!)" << sid << " -> " << node.nogood().c_str();
-        sid2nogood[entry->full_sid] = node.nogood();
+        sid2nogood.add(outgoing.entries.back().full_sid, node.nogood());
     }
 
     _prev_node_timestamp = node.time();
 
-    // handle node rate
+    publish();
+
+    return 0;
+}
+
+/// i-th element of a batch column, or `def` if the column was not sent
+template <typename Column, typename T>
+static inline T column(const Column& col, int i, T def) {
+    return i < col.size() ? col.Get(i) : def;
+}
+
+int Data::handleNodeBatch(message::NodeBatch& batch) {
+
+    delta_decoder.decode(batch);
+
+    const int n = batch.sid_size();
+    if (n == 0) return 0;
 
-    long long time_passed = static_cast<long long>(duration_cast<microseconds>(current_time - last_interval_time).count());
+    /// the whole batch arrived at once: the time goes to its first node
+    auto batch_time = takeNodeTime();
 
-    // qDebug() << "time passed: " << time_passed;
-    if (static_cast<long>(time_passed) > NODE_RATE_STEP) {
-        float nr = (nodes_arr.size() - last_interval_nc) * (float)NODE_RATE_STEP / time_passed;
-        node_rate.push_back(nr);
-        nr_intervals.push_back(last_interval_nc);
-        // qDebug() << "node rate: " << nr << " at node: " << last_interval_nc;
-        last_interval_time = current_time;
-        last_interval_nc = nodes_arr.size();
+    /// the batch's own label table, interned once per batch
+    std::vector<int> batch_labels;
+    batch_labels.reserve(batch.label_table_size());
+    for (const auto& label : batch.label_table()) {
+        batch_labels.push_back(labels().intern(label));
     }
 
-    // system_clock::time_point after_tp = system_clock::now();
-    // qDebug () << "receiving node takes: " <<
-    //     duration_cast<nanoseconds>(after_tp - current_time).count() << "ns";
+    std::vector<EntryRecord>& entries = outgoing.entries;
+    entries.reserve(n);
+
+    for (int i = 0; i < n; ++i) {
+        int sid = batch.sid(i);
+        int pid = column(batch.pid(), i, -1);
+        int restart_id = column(batch.restart_id(), i, 0);
+
+        int64_t real_pid = -1;
+        if (pid != -1) {
+            real_pid = (pid | ((int64_t)restart_id << 32));
+        }
+
+        int label_id = LabelTable::NO_LABEL;
+        int label_idx = column(batch.label(), i, -1);
+        if (label_idx >= 0 && label_idx < static_cast<int>(batch_labels.size())) {
+            label_id = batch_labels[label_idx];
+        } else if (i < batch.label_id_size()) {
+            label_id = wireLabel(batch.label_id(i));
+        }
+
+        entries.emplace_back(sid,
+                             restart_id,
+                             real_pid,
+                             column(batch.alt(), i, 0),
+                             column(batch.kids(), i, 0),
+                             label_id,
+                             column(batch.thread_id(), i, 0),
+                             column(batch.status(), i, 0),
+                             column(batch.time(), i, 0ull),
+                             i == 0 ? batch_time : 0,
+                             column(batch.domain_size(), i, 0.0f),
+                             column(batch.nogood_bld(), i, 0),
+                             column(batch.uses_assumptions(), i, false),
+                             column(batch.backjump_distance(), i, 0),
+                             column(batch.decision_level(), i, 0));
+    }
+
+    for (int j = 0; j < batch.info_idx_size() && j < batch.info_size(); ++j) {
+        int idx = batch.info_idx(j);
+        if (idx < 0 || idx >= n || batch.info(j).empty()) continue;
+        sid2info.add(entries[idx].full_sid, batch.info(j));
+    }
+
+    for (int j = 0; j < batch.nogood_idx_size() && j < batch.nogood_size(); ++j) {
+        int idx = batch.nogood_idx(j);
+        if (idx < 0 || idx >= n || batch.nogood(j).empty()) continue;
+        sid2nogood.add(entries[idx].full_sid, batch.nogood(j));
+    }
+
+    _prev_node_timestamp = entries.back().time_stamp;
+
+    publish();
 
     return 0;
 }
 
-std::string Data::getLabel(int gid) {
-    QMutexLocker locker(&dataMutex);
-
-    auto it = gid2entry.find(gid);
-    if (it != gid2entry.end() && it->second != nullptr)
-        return it->second->label;
-    return "";
+void Data::handleLabelDict(const message::Node& msg) {
+    const int first = std::max(msg.first_label_id(), 0);
+    const int n = msg.labels_size();
+    if (static_cast<int>(wire_labels.size()) < first + n) {
+        wire_labels.resize(first + n, LabelTable::NO_LABEL);
+    }
+    for (int i = 0; i < n; ++i) {
+        wire_labels[first + i] = labels().intern(msg.labels(i));
+    }
+}
 
+std::string Data::getLabel(int gid) {
+    int label_id = LabelTable::NO_LABEL;
+    {
+        QMutexLocker locker(&dataMutex);
+        auto entry = gid2entry.get(gid);
+        if (entry)
+            label_id = entry.label_id();
+    }
+    return labels().get(label_id);
 }
 
 int64_t Data::gid2sid(int gid) {
     QMutexLocker locker(&dataMutex);
 
     /// not for any gid there is entry (TODO: there should be a 'default' one)
-    auto it = gid2entry.find(gid);
-    if (it != gid2entry.end())
-        return gid2entry.at(gid)->full_sid;
+    auto entry = gid2entry.get(gid);
+    if (entry)
+        return entry.full_sid();
     return -1;
 
 }
@@ -201,40 +333,107 @@ unsigned long long Data::getTotalTime(void) {
 
     if (_isDone)
         return _total_time;
-    return nodes_arr.back()->time_stamp;
+    return _prev_node_timestamp;
 }
 
 
-Data::~Data(void) {
+Data::~Data(void) {}
+
+/// ***********************
+/// *** private methods ***
+/// ***********************
+
+// Called on the receiving thread.  Nothing is locked unless the builder
+// has fallen QUEUE_BATCHES batches behind; then entries pile up in
+// `overflow` until the queue has room for all of them at once.  While
+// loading, the entries are stored right away instead.
+void Data::publish() {
+    const int n = outgoing.entries.size();
+    if (n == 0) return;
+
+    outgoing.received = receive_time;
+    entries_received.fetch_add(n, std::memory_order_relaxed);
+
+    if (loading) {
+        /// nobody else looks at Data until the builder is started
+        appendEntries(outgoing.entries);
+        entries_taken.fetch_add(n, std::memory_order_relaxed);
+        outgoing.entries.clear();
+        return;
+    }
 
-    for (auto it = nodes_arr.begin(); it != nodes_arr.end();) {
-        delete (*it);
-        it = nodes_arr.erase(it);
+    if (!has_overflow.load(std::memory_order_acquire) && entry_queue.push(outgoing)) {
+        /// got the vector of a batch the builder is done with
+        outgoing.entries.clear();
+    } else {
+        QMutexLocker locker(&overflow_mutex);
+        if (overflow.entries.empty()) overflow.received = outgoing.received;
+        overflow.entries.insert(overflow.entries.end(),
+                                outgoing.entries.begin(), outgoing.entries.end());
+        outgoing.entries.clear();
+
+        const bool handed_over = entry_queue.push(overflow);
+        if (handed_over) overflow.entries.clear();
+        has_overflow.store(!handed_over, std::memory_order_release);
     }
 
-    for (auto it = sid2info.begin(); it != sid2info.end();) {
-        delete it->second;
-        it = sid2info.erase(it);
+    wakeBuilder();
+}
+
+void Data::wakeBuilder() {
+    /// pairs with the fence in waitForEntries: either the builder sees the
+    /// new entries, or this sees it waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (builder_waiting.load(std::memory_order_relaxed)) {
+        QMutexLocker locker(&wake_mutex);
+        wake.wakeOne();
     }
 }
 
-/// ***********************
-/// *** private methods ***
-/// ***********************
+bool Data::takeEntries(EntryBatch& batch) {
+    batch.entries.clear();
 
-// NOTE(maxim): this can be replaced with multiple arrays: one for each restart 
-void Data::pushInstance(DbEntry* entry) {
-    QMutexLocker locker(&dataMutex);
+    if (!entry_queue.pop(batch)) {
+        if (!has_overflow.load(std::memory_order_acquire)) return false;
 
-    /// NOTE(maxim): `sid` != `nodes_arr.size`, because there are also
+        /// while the overflow is non-empty, the queue only grows under the
+        /// lock, so whatever is in it now comes before the overflow
+        QMutexLocker locker(&overflow_mutex);
+        if (!entry_queue.pop(batch)) {
+            if (overflow.entries.empty()) return false;
+            std::swap(batch, overflow);
+            has_overflow.store(false, std::memory_order_release);
+        }
+    }
+
+    entries_taken.fetch_add(batch.entries.size(), std::memory_order_relaxed);
+    return true;
+}
+
+int Data::appendEntries(const std::vector<EntryRecord>& entries) {
+    /// NOTE(maxim): `sid` != `columns.size`, because there are also
     /// '-1' nodes (backjumped) that dont get counted
 
-    auto full_sid = entry->full_sid;
-    nodes_arr.push_back(entry);
+    const int first = columns.size();
+
+    for (const auto& entry : entries) {
+        sid2aid.insert(entry.full_sid, columns.push(entry));
+    }
 
-    sid2aid[full_sid] = nodes_arr.size() - 1;
+    return first;
+}
+
+void Data::waitForEntries() {
+    QMutexLocker locker(&wake_mutex);
+    builder_waiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (entry_queue.size() == 0 && !has_overflow.load(std::memory_order_acquire) &&
+        !_isDone) {
+        wake.wait(&wake_mutex);
+    }
 
-    // qDebug() << "sid2aid[" << full_sid << "] = " << sid2aid[full_sid];
+    builder_waiting.store(false, std::memory_order_relaxed);
 }
 
 
@@ -243,16 +442,18 @@ void Data::pushInstance(DbEntry* entry) {
 const std::string Data::getDebugInfo() const {
     std::ostringstream os;
 
-    os << "---nodes_arr---" << '\n';
-    for (auto it = nodes_arr.cbegin(); it != nodes_arr.end(); ++it) {
-      os << **(it) << "\n";
+    os << "---columns---" << '\n';
+    for (int aid = 0; aid < columns.size(); ++aid) {
+      os << DbEntry(const_cast<EntryColumns*>(&columns), aid) << "\n";
     }
     os << "---------------" << '\n';
 
     os << "---sid2nogood---" << '\n';
-    for (auto it = sid2nogood.cbegin(); it != sid2nogood.end();
-         it++) {
-      os << it->first << " -> " << it->second << "\n";
+    for (int aid = 0; aid < columns.size(); ++aid) {
+      const int64_t sid = columns.get(&EntryColumns::Segment::full_sid, aid);
+      if (sid2nogood.contains(sid)) {
+        os << sid << " -> " << sid2nogood.get(sid) << "\n";
+      }
     }
     os << "---------------" << '\n';
 
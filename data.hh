@@ -25,19 +25,32 @@
 #include <vector>
 #include <unordered_map>
 #include <QTimer>
+#include <atomic>
 #include <chrono>
 #include <QMutex>
+#include <QWaitCondition>
 
 #include <iostream>
 #include <string>
+#include <utility>
 
 #include <QDebug>
 
 #include <cstdint>
 #include <cassert>
 
+#include "blobstore.hh"
+#include "entrycolumns.hh"
+#include "gidindex.hh"
+#include "labeltable.hh"
+#include "mappedstore.hh"
+#include "sidindex.hh"
+#include "libs/delta_codec.hh"
+#include "spscqueue.hh"
+
 namespace message {
     class Node;
+    class NodeBatch;
 }
 
 enum MsgType {
@@ -46,63 +59,33 @@ enum MsgType {
   START_SENDING = 3
 };
 
-class DbEntry {
-
-public:
-    DbEntry(int sid, int restart_id, int64_t parent_id, int _alt, int _kids,
-            std::string _label, int tid, int _status, unsigned long long _time_stamp,
-            unsigned long long _node_time, float _domain, int _nogood_bld,
-            bool _uses_assumptions, int _backjump_distance, int _decision_level) :
-        s_node_id(sid), restart_id(restart_id), gid(-1), parent_sid(parent_id), alt(_alt), numberOfKids(_kids),
-        status(_status), label(_label), thread_id(tid), depth(-1), time_stamp(_time_stamp), node_time(_node_time),
-        domain(_domain), nogood_bld(_nogood_bld),
-        usesAssumptions(_uses_assumptions),
-        backjump_distance(_backjump_distance),
-        decision_level(_decision_level)
-    {
-    }
-
-    friend std::ostream& operator<<(std::ostream& s, const DbEntry& e);
-
-    union {
-        struct {
-            int32_t s_node_id; // solver node id
-            int32_t restart_id;
-        };
-        int64_t full_sid;
-    };
-    int gid; // gist id, set to -1 so we don't forget to assign the real value
-    int64_t parent_sid; // TODO(maxim): this needs only 32 bit integer, as restart_id is known
-    int alt; // which child by order
-    int numberOfKids;
-    int status;
-    std::string label;
-    int thread_id; 
-    int depth;
-    unsigned long long time_stamp;
-    unsigned long long node_time;
-    float domain;
-    int nogood_bld;
-    bool usesAssumptions;
-    int backjump_distance;
-    int decision_level;
+/// Entries handed from the receiving thread to the TreeBuilder
+struct EntryBatch {
+    std::vector<EntryRecord> entries;
+    /// when the entries were received
+    std::chrono::steady_clock::time_point received;
 };
 
 class Data : public QObject {
 Q_OBJECT
 
-    using system_clock = std::chrono::system_clock;
+    using steady_clock = std::chrono::steady_clock;
 
 /// step for node rate counter (in microseconds)
     static constexpr int NODE_RATE_STEP = 1000;
 
-    std::vector<DbEntry*> nodes_arr;
+    /// Memory for the columns and the nogood / info blocks, partly
+    /// mapped from a file if the execution is bigger than its budget
+    MappedStore store;
+
+    /// The nodes, in the order the builder took them (array ids)
+    EntryColumns columns;
 
     /// counts instances of Data
     static int instance_counter;
 
     // Whether received DONE_SENDING message
-    bool _isDone;
+    std::atomic<bool> _isDone;
 
     // Name of the FlatZinc model
     std::string _title;
@@ -112,37 +95,76 @@ Q_OBJECT
 
     unsigned long int _prev_node_timestamp;
 
-    /// How many nodes received within each NODE_RATE_STEP interval
-    std::vector<float> node_rate;
-
     /// derived properties
     int _time_per_node;
 
-    /// for node rate
-    system_clock::time_point begin_time;
-    system_clock::time_point last_interval_time;
-    system_clock::time_point current_time;
-
-    int last_interval_nc;
+    /// When the entries handled now were received (stampReceived), and
+    /// the stamp of the last entry given a node time
+    steady_clock::time_point receive_time;
+    steady_clock::time_point node_time_stamp;
+
+    /// for node rate: how many nodes had been received at a stamp, kept
+    /// for stamps at least NODE_RATE_STEP apart; the rate itself is only
+    /// worked out when asked for
+    struct RateSample {
+        int received;
+        steady_clock::time_point time;
+    };
+    std::vector<RateSample> rate_samples;
+    /// whether the last sample closes the last interval
+    bool rate_closed = false;
+    mutable QMutex rate_mutex;
 
     /// Map solver Id to no-good string
-    std::unordered_map<int64_t, std::string> sid2nogood;
-public:
+    BlobStore sid2nogood;
+
+    /// Per-thread state of DELTA-encoded batches
+    delta_codec::Decoder<message::NodeBatch> delta_decoder;
 
-    /// On which node each interval starts
-    std::vector<int> nr_intervals;
+    /// Label ids declared by the solver (LABEL_DICT) -> ids in labels()
+    std::vector<int> wire_labels;
+
+    /// Table id of a label id sent by the solver
+    int wireLabel(int wire_id) const {
+        return (wire_id >= 0 && wire_id < static_cast<int>(wire_labels.size()))
+            ? wire_labels[wire_id] : LabelTable::NO_LABEL;
+    }
+
+    /// Received entries on their way to the builder, which is the only
+    /// one to write the columns and sid2aid; the receiving thread never
+    /// takes dataMutex for them
+    SpscQueue<EntryBatch> entry_queue;
+    /// entries collected by the receiving thread, not published yet
+    EntryBatch outgoing;
+    /// entries that arrived while the queue was full; they come after
+    /// everything in the queue
+    QMutex overflow_mutex;
+    EntryBatch overflow;
+    std::atomic<bool> has_overflow{false};
+
+    std::atomic<int> entries_received{0};
+    std::atomic<int> entries_taken{0};
+
+    /// the builder sleeps here when it has nothing to do
+    QMutex wake_mutex;
+    QWaitCondition wake;
+    std::atomic<bool> builder_waiting{false};
+    void wakeBuilder();
+
+    /// Whether entries go straight into the columns (startLoading)
+    bool loading = false;
+public:
 
     /// Maps gist Id to dbEntry (possibly in the other Data instance);
     /// i.e. needed for a merged tree to show labels etc.
-    /// TODO(maixm): this should probably be a vector?
-    std::unordered_map<int, DbEntry*> gid2entry;
+    GidIndex gid2entry;
 
 
-    std::unordered_map<int64_t, std::string*> sid2info;
+    /// Map solver Id to info string
+    BlobStore sid2info;
 
-    /// Mapping from solver Id to array Id (nodes_arr)
-    /// can't use vector because sid is too big with threads
-    std::unordered_map<int64_t, int> sid2aid;
+    /// Mapping from solver Id to array Id (columns)
+    SidIndex sid2aid;
 
     /// used to access Data instance from different threads (in parallel solver)
     QMutex dataMutex;
@@ -150,41 +172,112 @@ public:
 private:
     // int _total_nodes;
 
-    /// Populate nodes_arr with the data coming from
-    void pushInstance(DbEntry* entry);
+    /// Hand the entries in `outgoing` over to the builder
+    void publish();
+
+    /// Microseconds from the previous stamp that had nodes to this one,
+    /// for the first node received at this stamp; 0 for the others
+    long long takeNodeTime();
 
 public:
 
     Data();
     ~Data(void);
 
+    /// From now on, store entries in the columns and sid2aid as they are
+    /// handled, without the queue or dataMutex; only for an execution
+    /// read from a file on one thread, before the builder is started
+    void startLoading() { loading = true; }
+
+    /// The nodes handled from now on were received at `when`; called on
+    /// the receiving thread once per chunk, not per node
+    void stampReceived(steady_clock::time_point when);
+
+    /// Nogood and info strings go to the blob stores; the label is
+    /// interned (or looked up by its id)
     int handleNodeCallback(message::Node& node);
 
+    /// Intern the labels of a LABEL_DICT message
+    void handleLabelDict(const message::Node& msg);
+
+    /// Decode all nodes of a NODE_BATCH message (plain or DELTA) at once;
+    /// nogood and info strings go to the blob stores
+    int handleNodeBatch(message::NodeBatch& batch);
+
     /// TODO(maxim): Do I want a reference here?
     /// return label by gid (Gist ID)
     std::string getLabel(int gid);
 
+    /// The labels of all executions
+    static LabelTable& labels();
+
+    /// return label of an entry (of any execution)
+    static std::string labelOf(const DbEntry& entry) {
+        return labels().get(entry.label_id());
+    }
+
     /// return solver id by gid (Gist ID)
     int64_t gid2sid(int gid);
 
-    void connectNodeToEntry(int gid, DbEntry* const entry);
+    void connectNodeToEntry(int gid, DbEntry entry);
+
+    /// return total number of nodes (taken by the builder so far)
+    int size() const { return columns.size(); }
+
+    /// Capacity of the queue to the builder, in batches
+    static constexpr int QUEUE_BATCHES = 1024;
 
-    /// return total number of nodes
-    int size() const { return nodes_arr.size(); }
+    /// Number of entries received; can be called from any thread
+    int receivedCount() const { return entries_received.load(std::memory_order_relaxed); }
+
+    /// Number of received entries the builder has not taken yet (and
+    /// batches they are in); can be called from any thread
+    int queueDepth() const {
+        return entries_received.load(std::memory_order_relaxed) -
+               entries_taken.load(std::memory_order_relaxed);
+    }
+    int queuedBatches() const { return entry_queue.size(); }
+
+    /// On which node each node rate interval starts, followed by the
+    /// number of nodes received so far; can be called from any thread
+    std::vector<int> nodeRateIntervals() const;
+    /// Nodes received per NODE_RATE_STEP within each closed interval
+    std::vector<float> nodeRate() const;
+
+/// ********* BUILDER THREAD ONLY **********
+
+    /// Take the oldest batch of received entries, if any
+    bool takeEntries(EntryBatch& batch);
+
+    /// Store taken entries and add them to sid2aid (dataMutex held, unless
+    /// loading); returns the array id of the first one
+    int appendEntries(const std::vector<EntryRecord>& entries);
+
+    /// Sleep until entries are published or receiving is done; both
+    /// wake the builder, so there is no timeout
+    void waitForEntries();
+
+/// ****************************
 
 /// ********* GETTERS **********
 
     bool isDone(void) { return _isDone; }
     // bool isRestarts(void) { return _isRestarts; }
     std::string getTitle(void) { return _title; }
-    const std::vector<DbEntry*>& getEntries() const { return nodes_arr; }
-    inline const std::unordered_map<int64_t, std::string>& getNogoods(void) { return sid2nogood; }
-    inline std::unordered_map<int64_t, std::string*>& getInfo(void) { return sid2info; }
+    const EntryColumns& getColumns() const { return columns; }
+    const MappedStore& getStore() const { return store; }
+    /// the entry with array id `aid`
+    DbEntry entryAt(int aid) { return DbEntry(&columns, aid); }
+    inline const BlobStore& getNogoods(void) { return sid2nogood; }
+    inline const BlobStore& getInfo(void) { return sid2info; }
 
     unsigned long long getTotalTime(void); /// time in microseconds
 
-    int getGidBySid(int64_t sid) { return nodes_arr[sid2aid[sid]]->gid; }
-    DbEntry* getEntry(int gid) const;
+    int getGidBySid(int64_t sid) {
+        const int aid = sid2aid.find(sid);
+        return aid == -1 ? -1 : entryAt(aid).gid();
+    }
+    DbEntry getEntry(int gid) const;
 
 
 /// ****************************
@@ -207,18 +300,13 @@ public:
 };
 
 inline
-void Data::connectNodeToEntry(int gid, DbEntry* entry) {
-    gid2entry[gid] = entry;
+void Data::connectNodeToEntry(int gid, DbEntry entry) {
+    gid2entry.set(gid, entry);
 }
 
 inline
-DbEntry* Data::getEntry(int gid) const {
-    auto it = gid2entry.find(gid);
-    if (it != gid2entry.end()) {
-        return it->second;
-    } else {
-        return nullptr;
-    }
+DbEntry Data::getEntry(int gid) const {
+    return gid2entry.get(gid);
 }
 
 
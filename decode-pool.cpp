@@ -0,0 +1,159 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "decode-pool.hh"
+#include "ingest-reactor.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+DecodePool::DecodePool(int threads) {
+    for (int i = 0; i < std::max(threads, 1); ++i) {
+        _workers.emplace_back(&DecodePool::work, this);
+    }
+}
+
+DecodePool::~DecodePool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _quit = true;
+    }
+    _cv.notify_all();
+    for (auto& worker : _workers) worker.join();
+
+    for (auto chunk : _jobs) delete chunk;
+}
+
+void
+DecodePool::submit(FrameChunk* chunk) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.push_back(chunk);
+    }
+    _cv.notify_one();
+}
+
+void
+DecodePool::work() {
+    while (true) {
+        FrameChunk* chunk;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this]() { return _quit || !_jobs.empty(); });
+            if (_quit) return;
+            chunk = _jobs.front();
+            _jobs.pop_front();
+        }
+        decode(*chunk);
+        chunk->reactor->decoded(chunk);
+    }
+}
+
+/// Append `node` to `batch`, moving its strings; `labels` maps the labels
+/// already in the batch's label table to their index
+static void appendNode(message::NodeBatch& batch, message::Node& node,
+                       std::unordered_map<std::string, int>& labels) {
+    const int i = batch.sid_size();
+
+    batch.add_sid(node.sid());
+    batch.add_pid(node.pid());
+    batch.add_alt(node.alt());
+    batch.add_kids(node.kids());
+    batch.add_status(node.status());
+    batch.add_restart_id(node.restart_id());
+    batch.add_time(node.time());
+    batch.add_thread_id(node.thread_id());
+    batch.add_domain_size(node.domain_size());
+    batch.add_decision_level(node.decision_level());
+    batch.add_nogood_bld(node.nogood_bld());
+    batch.add_uses_assumptions(node.uses_assumptions());
+    batch.add_backjump_distance(node.backjump_distance());
+
+    if (node.has_label_id()) {
+        batch.add_label(-1);
+        batch.add_label_id(node.label_id());
+    } else {
+        auto it = labels.find(node.label());
+        if (it == labels.end()) {
+            const int idx = batch.label_table_size();
+            it = labels.emplace(node.label(), idx).first;
+            batch.add_label_table()->swap(*node.mutable_label());
+        }
+        batch.add_label(it->second);
+        batch.add_label_id(-1);
+    }
+
+    if (node.has_nogood() && !node.nogood().empty()) {
+        batch.add_nogood_idx(i);
+        batch.add_nogood()->swap(*node.mutable_nogood());
+    }
+    if (node.has_info() && !node.info().empty()) {
+        batch.add_info_idx(i);
+        batch.add_info()->swap(*node.mutable_info());
+    }
+}
+
+void
+DecodePool::decode(FrameChunk& chunk) {
+    thread_local message::Node node;
+    thread_local std::unordered_map<std::string, int> labels;
+
+    /// the NODE_BATCH consecutive NODE messages go to, if any
+    message::NodeBatch* batch = nullptr;
+
+    auto nextMessage = [&chunk]() -> message::Node& {
+        if (chunk.count == static_cast<int>(chunk.messages.size())) {
+            chunk.messages.emplace_back();
+        }
+        message::Node& msg = chunk.messages[chunk.count++];
+        msg.Clear();
+        return msg;
+    };
+
+    const char* p = chunk.frames.data();
+    const char* end = p + chunk.frames.size();
+    while (p + 4 <= end) {
+        uint32_t size;
+        std::memcpy(&size, p, 4);
+        p += 4;
+        if (size > static_cast<uint32_t>(end - p)) break;
+
+        if (!node.ParseFromArray(p, size)) {
+            p += size;
+            continue;
+        }
+        p += size;
+
+        if (node.type() == message::Node::NODE) {
+            if (!batch) {
+                message::Node& msg = nextMessage();
+                msg.set_type(message::Node::NODE_BATCH);
+                batch = msg.mutable_batch();
+                labels.clear();
+            }
+            appendNode(*batch, node, labels);
+        } else {
+            batch = nullptr;
+            nextMessage().Swap(&node);
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef DECODE_POOL_HH
+#define DECODE_POOL_HH
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "message.pb.hh"
+
+class IngestConnection;
+class IngestReactor;
+
+/// A run of complete frames from one connection.  The reactor thread only
+/// cuts the byte stream into chunks; a DecodePool worker parses them, and
+/// the reactor commits them again in the order they were cut.
+struct FrameChunk {
+  IngestConnection* connection = nullptr;
+  IngestReactor* reactor = nullptr;
+  /// position in the connection's stream of chunks
+  uint64_t seq = 0;
+  /// when the first of the frames was read
+  std::chrono::steady_clock::time_point received;
+
+  /// length-prefixed frames, as received
+  std::string frames;
+
+  /// The decoded messages, `messages[0, count)`.  Consecutive NODE messages
+  /// are merged into a single NODE_BATCH, so that they reach Data as one
+  /// batch.  The objects are kept for the next chunk.
+  std::vector<message::Node> messages;
+  int count = 0;
+
+  void clear() {
+    frames.clear();
+    count = 0;
+  }
+};
+
+/// A few threads decoding FrameChunks for all connections
+class DecodePool {
+ public:
+  explicit DecodePool(int threads);
+  /// Joins the workers; chunks still waiting are discarded
+  ~DecodePool();
+
+  DecodePool(const DecodePool&) = delete;
+  DecodePool& operator=(const DecodePool&) = delete;
+
+  /// Decode `chunk`, then hand it back to its reactor (IngestReactor::decoded)
+  void submit(FrameChunk* chunk);
+
+  /// Parse `chunk->frames` into `chunk->messages`
+  static void decode(FrameChunk& chunk);
+
+ private:
+  std::vector<std::thread> _workers;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<FrameChunk*> _jobs;
+  bool _quit = false;
+
+  void work();
+};
+
+#endif
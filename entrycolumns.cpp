@@ -0,0 +1,120 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "entrycolumns.hh"
+#include "mappedstore.hh"
+
+#include <limits>
+
+/// bytes of all columns for one node
+static constexpr size_t NODE_BYTES =
+    2 * sizeof(uint64_t) + 11 * sizeof(int32_t) + sizeof(float) + 2 * sizeof(int8_t);
+/// bytes of the columns the builder still writes after push (gid and
+/// depth), which are carved last so the rest of a segment can be sealed
+static constexpr size_t BUILDER_BYTES = 2 * sizeof(int32_t);
+
+/// Segments hold a multiple of 1024 nodes, so every column starts aligned
+/// when the 8-byte ones come first
+template <typename T>
+static T* carve(char*& p, int n) {
+    T* column = reinterpret_cast<T*>(p);
+    p += sizeof(T) * n;
+    return column;
+}
+
+EntryColumns::~EntryColumns() {
+    if (_store) return;
+    for (char* block : _blocks) delete[] block;
+}
+
+void EntryColumns::allocate(int seg) {
+    const int n = segmentCapacity(seg);
+    _blocks[seg] = _store ? _store->allocate(NODE_BYTES * n)
+                          : new char[NODE_BYTES * n];
+
+    /// the previous segment is full: all but its gid and depth columns
+    /// are final
+    if (_store && seg > 0) {
+        _store->seal(_blocks[seg - 1],
+                     (NODE_BYTES - BUILDER_BYTES) * segmentCapacity(seg - 1));
+    }
+
+    char* p = _blocks[seg];
+    Segment& s = _segments[seg];
+    s.full_sid = carve<int64_t>(p, n);
+    s.time_stamp = carve<uint64_t>(p, n);
+    s.pid = carve<int32_t>(p, n);
+    s.alt = carve<int32_t>(p, n);
+    s.kids = carve<int32_t>(p, n);
+    s.label_id = carve<int32_t>(p, n);
+    s.thread_id = carve<int32_t>(p, n);
+    s.node_time = carve<uint32_t>(p, n);
+    s.nogood_bld = carve<int32_t>(p, n);
+    s.backjump_distance = carve<int32_t>(p, n);
+    s.decision_level = carve<int32_t>(p, n);
+    s.domain = carve<float>(p, n);
+    s.status = carve<int8_t>(p, n);
+    s.uses_assumptions = carve<uint8_t>(p, n);
+    /// written by the builder after push; n is a multiple of 1024, so
+    /// they are still aligned
+    s.gid = carve<int32_t>(p, n);
+    s.depth = carve<int32_t>(p, n);
+}
+
+int EntryColumns::push(const EntryRecord& e) {
+    const int aid = _size.load(std::memory_order_relaxed);
+
+    int seg, off;
+    locate(aid, seg, off);
+    if (!_blocks[seg]) allocate(seg);
+
+    static constexpr unsigned long long MAX_NODE_TIME =
+        std::numeric_limits<uint32_t>::max();
+
+    Segment& s = _segments[seg];
+    s.full_sid[off] = e.full_sid;
+    s.time_stamp[off] = e.time_stamp;
+    s.pid[off] = e.parent_sid == -1 ? -1 : static_cast<int32_t>(e.parent_sid);
+    s.alt[off] = e.alt;
+    s.kids[off] = e.numberOfKids;
+    s.label_id[off] = e.label_id;
+    s.thread_id[off] = e.thread_id;
+    s.gid[off] = -1;
+    s.depth[off] = -1;
+    s.node_time[off] = std::min(e.node_time, MAX_NODE_TIME);
+    s.nogood_bld[off] = e.nogood_bld;
+    s.backjump_distance[off] = e.backjump_distance;
+    s.decision_level[off] = e.decision_level;
+    s.domain[off] = e.domain;
+    s.status[off] = e.status;
+    s.uses_assumptions[off] = e.usesAssumptions;
+
+    _size.store(aid + 1, std::memory_order_release);
+    return aid;
+}
+
+size_t EntryColumns::bytes() const {
+    size_t total = 0;
+    for (int seg = 0; seg < MAX_SEGMENTS; ++seg) {
+        if (_blocks[seg]) total += NODE_BYTES * segmentCapacity(seg);
+    }
+    return total;
+}
@@ -0,0 +1,213 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef ENTRY_COLUMNS_HH
+#define ENTRY_COLUMNS_HH
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+
+class MappedStore;
+
+/// One node as decoded from a message, on its way to the builder
+struct EntryRecord {
+    EntryRecord(int sid, int restart_id, int64_t parent_id, int _alt, int _kids,
+                int _label_id, int tid, int _status, unsigned long long _time_stamp,
+                unsigned long long _node_time, float _domain, int _nogood_bld,
+                bool _uses_assumptions, int _backjump_distance, int _decision_level) :
+        s_node_id(sid), restart_id(restart_id), parent_sid(parent_id), alt(_alt),
+        numberOfKids(_kids), status(_status), label_id(_label_id), thread_id(tid),
+        time_stamp(_time_stamp), node_time(_node_time), domain(_domain),
+        nogood_bld(_nogood_bld), usesAssumptions(_uses_assumptions),
+        backjump_distance(_backjump_distance), decision_level(_decision_level)
+    {
+    }
+
+    union {
+        struct {
+            int32_t s_node_id; // solver node id
+            int32_t restart_id;
+        };
+        int64_t full_sid;
+    };
+    int64_t parent_sid;
+    int alt; // which child by order
+    int numberOfKids;
+    int status;
+    int label_id; // see Data::labelOf
+    int thread_id;
+    unsigned long long time_stamp;
+    unsigned long long node_time;
+    float domain;
+    int nogood_bld;
+    bool usesAssumptions;
+    int backjump_distance;
+    int decision_level;
+};
+
+/// The nodes of an execution, stored field by field and indexed by array
+/// id (the order nodes were taken by the builder), so that looking at one
+/// field of many nodes reads only that field.
+///
+/// Storage grows by segments of doubling size which are never moved or
+/// freed before destruction: other threads can keep reading stored nodes
+/// while the builder appends new ones.  The segments come from a
+/// MappedStore if one is given, otherwise from the heap.
+class EntryColumns {
+public:
+    /// Each column of a segment is a plain array
+    struct Segment {
+        int64_t* full_sid;
+        int32_t* pid;          /// parent's s_node_id, -1 for roots
+        int32_t* alt;
+        int32_t* kids;
+        int32_t* label_id;
+        int32_t* thread_id;
+        int32_t* gid;          /// -1 until the node is in the tree
+        int32_t* depth;
+        uint64_t* time_stamp;
+        uint32_t* node_time;   /// saturates at about 71 minutes
+        float* domain;
+        int32_t* nogood_bld;
+        int32_t* backjump_distance;
+        int32_t* decision_level;
+        int8_t* status;
+        uint8_t* uses_assumptions;
+    };
+
+    /// the first segment holds 2^FIRST_BITS nodes, each next one twice
+    /// as many as the one before
+    static constexpr int FIRST_BITS = 10;
+    static constexpr int MAX_SEGMENTS = 31 - FIRST_BITS;
+
+    explicit EntryColumns(MappedStore* store = nullptr) : _store(store) {}
+    ~EntryColumns();
+
+    EntryColumns(const EntryColumns&) = delete;
+    EntryColumns& operator=(const EntryColumns&) = delete;
+
+    /// Number of stored nodes; can be called from any thread
+    int size() const { return _size.load(std::memory_order_acquire); }
+
+    /// Store a node, returns its array id; builder thread only
+    int push(const EntryRecord& entry);
+
+    /// Bytes allocated for the columns
+    size_t bytes() const;
+
+    template <typename T>
+    T get(T* Segment::*column, int aid) const {
+        int seg, off;
+        locate(aid, seg, off);
+        return (_segments[seg].*column)[off];
+    }
+
+    template <typename T>
+    void set(T* Segment::*column, int aid, T value) {
+        int seg, off;
+        locate(aid, seg, off);
+        (_segments[seg].*column)[off] = value;
+    }
+
+    /// Nodes [first, first + len) of `column` as one array: a full scan is
+    /// a loop over segments 0, 1, ... until len is 0
+    template <typename T>
+    const T* span(T* Segment::*column, int seg, int& first, int& len) const {
+        first = segmentStart(seg);
+        const int end = std::min(size(), first + segmentCapacity(seg));
+        len = std::max(end - first, 0);
+        return len > 0 ? _segments[seg].*column : nullptr;
+    }
+
+    static int segmentCapacity(int seg) { return 1 << (seg + FIRST_BITS); }
+    static int segmentStart(int seg) { return segmentCapacity(seg) - (1 << FIRST_BITS); }
+
+private:
+    Segment _segments[MAX_SEGMENTS] = {};
+    MappedStore* _store;
+    /// one allocation per segment, carved into the columns
+    char* _blocks[MAX_SEGMENTS] = {};
+    std::atomic<int> _size{0};
+
+    static void locate(int aid, int& seg, int& off) {
+        const unsigned j = static_cast<unsigned>(aid) + (1u << FIRST_BITS);
+        const int bit = 31 - __builtin_clz(j);
+        seg = bit - FIRST_BITS;
+        off = static_cast<int>(j - (1u << bit));
+    }
+
+    void allocate(int seg);
+};
+
+/// A node stored in the columns of some Data (see Data::getEntry): which
+/// columns, and the node's array id.  Cheap to copy; false if there is no
+/// such node.
+class DbEntry {
+    using Column = EntryColumns::Segment;
+
+    EntryColumns* _columns = nullptr;
+    int _aid = -1;
+
+public:
+    DbEntry() = default;
+    DbEntry(EntryColumns* columns, int aid) : _columns(columns), _aid(aid) {}
+
+    explicit operator bool() const { return _columns != nullptr; }
+
+    /// whose columns
+    EntryColumns* columns() const { return _columns; }
+
+    friend std::ostream& operator<<(std::ostream& s, const DbEntry& e);
+
+    int aid() const { return _aid; }
+
+    int64_t full_sid() const { return _columns->get(&Column::full_sid, _aid); }
+    int32_t s_node_id() const { return static_cast<int32_t>(full_sid()); } // solver node id
+    int32_t restart_id() const { return static_cast<int32_t>(full_sid() >> 32); }
+    /// gist id, -1 until the node is in the tree
+    int gid() const { return _columns->get(&Column::gid, _aid); }
+    int64_t parent_sid() const {
+        const int64_t pid = _columns->get(&Column::pid, _aid);
+        return pid == -1 ? -1 : (pid | (static_cast<int64_t>(restart_id()) << 32));
+    }
+    int alt() const { return _columns->get(&Column::alt, _aid); } // which child by order
+    int numberOfKids() const { return _columns->get(&Column::kids, _aid); }
+    int status() const { return _columns->get(&Column::status, _aid); }
+    int label_id() const { return _columns->get(&Column::label_id, _aid); } // see Data::labelOf
+    int thread_id() const { return _columns->get(&Column::thread_id, _aid); }
+    int depth() const { return _columns->get(&Column::depth, _aid); }
+    unsigned long long time_stamp() const { return _columns->get(&Column::time_stamp, _aid); }
+    unsigned long long node_time() const { return _columns->get(&Column::node_time, _aid); }
+    float domain() const { return _columns->get(&Column::domain, _aid); }
+    int nogood_bld() const { return _columns->get(&Column::nogood_bld, _aid); }
+    bool usesAssumptions() const { return _columns->get(&Column::uses_assumptions, _aid); }
+    int backjump_distance() const { return _columns->get(&Column::backjump_distance, _aid); }
+    int decision_level() const { return _columns->get(&Column::decision_level, _aid); }
+
+    /// set by the TreeBuilder
+    void set_gid(int gid) { _columns->set<int32_t>(&Column::gid, _aid, gid); }
+    void set_depth(int depth) { _columns->set<int32_t>(&Column::depth, _aid, depth); }
+};
+
+#endif
@@ -13,6 +13,24 @@ Data* Execution::getData() const {
 }
 
 void Execution::start(std::string label, bool isRestarts) {
+    prepare(label, isRestarts);
+
+    m_Builder->start();
+
+    emit titleKnown();
+}
+
+void Execution::startLoading(std::string label, bool isRestarts) {
+    m_Data->startLoading();
+    prepare(label, isRestarts);
+
+    /// connected after Data::setDoneReceiving, so it comes second
+    connect(this, &Execution::doneReceiving, [this]() { m_Builder->startBulk(); });
+
+    emit titleKnown();
+}
+
+void Execution::prepare(std::string label, bool isRestarts) {
 
     _is_restarts = isRestarts;
 
@@ -31,41 +49,94 @@ void Execution::start(std::string label, bool isRestarts) {
 
     std::cerr << "Execution::start on " << this << "\n";
 
-    connect(m_Builder.get(), &TreeBuilder::addedNode, this, &Execution::newNode);
+    connect(m_Builder.get(), &TreeBuilder::addedNodes, this, &Execution::newNodes);
     connect(m_Builder.get(), &TreeBuilder::addedRoot, this, &Execution::newRoot);
-
-    m_Builder->start();
-
-    emit titleKnown();
 }
 
-const std::string* Execution::getNogood(const Node& node) const {
+std::string Execution::getNogood(const Node& node) const {
     auto entry = getEntry(node);
-    if (!entry) return nullptr;
-    auto nogood = m_Data->getNogoods().find(entry->full_sid);
-    if (nogood == m_Data->getNogoods().end()) return nullptr;
-    return &nogood->second;
+    if (!entry) return std::string();
+    return m_Data->getNogoods().get(entry.full_sid());
 }
 
-const std::string* Execution::getInfo(const Node& node) const {
+std::string Execution::getInfo(const Node& node) const {
     auto entry = getEntry(node);
-    if (!entry) return nullptr;
-    auto info = m_Data->sid2info.find(entry->s_node_id);
-    if (info == m_Data->sid2info.end()) return nullptr;
-    return info->second;
+    if (!entry) return std::string();
+    return m_Data->getInfo().get(entry.full_sid());
+}
+
+void Execution::handleLabelDict(const message::Node& msg) {
+    m_Data->handleLabelDict(msg);
+}
+
+MemoryUsage Execution::memoryUsage() {
+    MemoryUsage usage;
+
+    usage.labels = Data::labels().bytes();
+    usage.nogoods = m_Data->getNogoods().bytes();
+    usage.info = m_Data->getInfo().bytes();
+    usage.mapped = m_Data->getStore().mappedBytes();
+    {
+        /// the builder adds entries under dataMutex
+        QMutexLocker locker(&m_Data->dataMutex);
+        usage.entries = m_Data->getColumns().bytes();
+        usage.indexes = m_Data->sid2aid.bytes() + m_Data->gid2entry.bytes();
+    }
+    {
+        QMutexLocker locker(&getMutex());
+        const NodeAllocator& na = getNA();
+        usage.nodes = na.bytes();
+        usage.children = na.childBytes();
+        usage.shapes = na.shapeBytes();
+    }
+    {
+        QMutexLocker locker(&view_mutex);
+        for (const auto& view : view_bytes) usage.views += view.second;
+    }
+
+    return usage;
+}
+
+void Execution::setViewBytes(const void* view, size_t bytes) {
+    QMutexLocker locker(&view_mutex);
+    if (bytes == 0) {
+        view_bytes.erase(view);
+    } else {
+        view_bytes[view] = bytes;
+    }
+}
+
+int Execution::getBacklog() const {
+    return m_Data->receivedCount() - m_Builder->entriesRead();
+}
+
+int Execution::getQueueDepth() const {
+    return m_Data->queueDepth();
+}
+
+int Execution::getNodesRead() const {
+    return m_Builder->entriesRead();
+}
+
+void Execution::setReceiveTime(std::chrono::steady_clock::time_point when) {
+    m_Data->stampReceived(when);
 }
 
 void Execution::handleNewNode(message::Node& node) {
     m_Data->handleNodeCallback(node);
 }
 
-const std::unordered_map<int64_t, string>& Execution::getNogoods() const {
+void Execution::handleNewBatch(message::NodeBatch& batch) {
+    m_Data->handleNodeBatch(batch);
+}
+
+const BlobStore& Execution::getNogoods() const {
   return m_Data->getNogoods();
 }
-std::unordered_map<int64_t, string*>& Execution::getInfo(void) const {
+const BlobStore& Execution::getInfo(void) const {
   return m_Data->getInfo();
 }
-DbEntry* Execution::getEntry(int gid) const { return m_Data->getEntry(gid); }
+DbEntry Execution::getEntry(int gid) const { return m_Data->getEntry(gid); }
 unsigned int Execution::getGidBySid(int sid) { return m_Data->getGidBySid(sid); }
 std::string Execution::getLabel(int gid) const { return m_Data->getLabel(gid); }
 unsigned long long Execution::getTotalTime() { return m_Data->getTotalTime(); }
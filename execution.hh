@@ -7,14 +7,15 @@
 #include <ctime>
 #include <memory>
 #include "nodetree.hh"
+#include "data.hh"
+#include "memoryusage.hh"
 #include <unordered_map>
 
-class Data;
-class DbEntry;
 class NodeAllocator;
 
 namespace message {
     class Node;
+    class NodeBatch;
 }
 
 class TreeBuilder;
@@ -29,8 +30,9 @@ public:
     Execution& operator=(const Execution&) = delete;
     ~Execution();
 
-    const std::string* getNogood(const Node& node) const;
-    const std::string* getInfo(const Node& node) const;
+    /// The node's nogood / info string, empty if it has none
+    std::string getNogood(const Node& node) const;
+    std::string getInfo(const Node& node) const;
 
     std::string getTitle() const;
     std::string getDescription() {
@@ -39,7 +41,7 @@ public:
         return ss.str();
     }
     
-    DbEntry* getEntry(const Node& node) const {
+    DbEntry getEntry(const Node& node) const {
         auto gid = node.getIndex(getNA());
         return getEntry(gid);
     }
@@ -54,9 +56,9 @@ public:
         return node_tree;
     }
 
-    const std::unordered_map<int64_t, std::string>& getNogoods() const;
-    std::unordered_map<int64_t, std::string*>& getInfo(void) const;
-    DbEntry* getEntry(int gid) const;
+    const BlobStore& getNogoods() const;
+    const BlobStore& getInfo(void) const;
+    DbEntry getEntry(int gid) const;
     unsigned int getGidBySid(int sid);
     std::string getLabel(int gid) const;
     unsigned long long getTotalTime();
@@ -64,6 +66,27 @@ public:
     Data* getData() const;
 
     void start(std::string label, bool isRestarts);
+    /// Like start, for an execution read from a file: its entries are
+    /// stored as they are handled, and the whole tree is built at once
+    /// on doneReceiving
+    void startLoading(std::string label, bool isRestarts);
+
+    /// When the nodes handled next were received; on the receiving thread
+    void setReceiveTime(std::chrono::steady_clock::time_point when);
+
+    /// Number of received nodes the builder has not looked at yet;
+    /// called on the receiving thread
+    int getBacklog() const;
+    /// Number of nodes the builder has looked at
+    int getNodesRead() const;
+    /// Number of received nodes not yet handed to the builder
+    int getQueueDepth() const;
+
+    /// Bytes held by this execution, by what they are for
+    MemoryUsage memoryUsage();
+    /// Report the buffers of a view of this execution (0 when the view
+    /// goes away)
+    void setViewBytes(const void* view, size_t bytes);
 
     bool isDone() const { return _is_done; }
     bool isRestarts() const { return _is_restarts; }
@@ -89,7 +112,8 @@ public:
     }
 
 signals:
-    void newNode();
+    /// `count` nodes were added to the tree
+    void newNodes(int count);
     void newRoot();
     void titleKnown();
     void startReceiving();
@@ -103,8 +127,16 @@ private:
     bool _is_done = false;
     bool _is_restarts;
     std::string variableListString;
+
+    /// What start and startLoading have in common
+    void prepare(std::string label, bool isRestarts);
+
+    QMutex view_mutex;
+    std::unordered_map<const void*, size_t> view_bytes;
 public Q_SLOTS:
     void handleNewNode(message::Node& node);
+    void handleNewBatch(message::NodeBatch& batch);
+    void handleLabelDict(const message::Node& msg);
 
 };
 
@@ -0,0 +1,105 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "framereader.hh"
+
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+
+using google::protobuf::io::ArrayInputStream;
+using google::protobuf::io::ConcatenatingInputStream;
+using google::protobuf::io::ZeroCopyInputStream;
+
+bool
+FrameReader::frameReady() {
+    if (_oversized) return false;
+
+    // Read the header (which contains the size of the body)
+    while (_size == 0) {
+        if (_buffer.size() < 4) return false;
+        _buffer.peek(reinterpret_cast<char*>(&_size), 4);
+        _buffer.consume(4);
+        if (_size > MAX_FRAME_BYTES) {
+            _oversized = true;
+            return false;
+        }
+        // make sure the whole frame can be held by the buffer
+        _buffer.reserve(_size);
+    }
+    return _buffer.size() >= _size;
+}
+
+int
+FrameReader::peekType() {
+    if (!frameReady()) return NO_FRAME;
+
+    // `type` is field 1 and serialized first: tag 0x08, then a varint
+    // that fits in one byte for all the types there are
+    char head[2];
+    if (_size < 2) return UNKNOWN_TYPE;
+    _buffer.peek(head, 2);
+    if (head[0] != 0x08 || (head[1] & 0x80)) return UNKNOWN_TYPE;
+    return head[1];
+}
+
+bool
+FrameReader::take(std::string& out) {
+    if (!frameReady()) return false;
+
+    const uint32_t size = _size;
+    out.append(reinterpret_cast<const char*>(&size), 4);
+
+    const char *p1, *p2;
+    uint64_t len1, len2;
+    _buffer.readSpans(_size, p1, len1, p2, len2);
+    out.append(p1, len1);
+    out.append(p2, len2);
+
+    _buffer.consume(_size);
+    _size = 0;
+    return true;
+}
+
+message::Node*
+FrameReader::next() {
+    if (!frameReady()) return nullptr;
+
+    const char *p1, *p2;
+    uint64_t len1, len2;
+    _buffer.readSpans(_size, p1, len1, p2, len2);
+
+    if (len2 == 0) {
+        _msg.ParseFromArray(p1, _size);
+    } else {
+        // the frame wraps around the end of the buffer: parse it
+        // from both pieces in place rather than copying it out
+        ArrayInputStream first(p1, len1);
+        ArrayInputStream second(p2, len2);
+        ZeroCopyInputStream* pieces[] = {&first, &second};
+        ConcatenatingInputStream input(pieces, 2);
+        _msg.ParseFromZeroCopyStream(&input);
+    }
+
+    _buffer.consume(_size);
+    _size = 0;
+
+    return &_msg;
+}
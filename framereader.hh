@@ -0,0 +1,79 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef FRAME_READER_HH
+#define FRAME_READER_HH
+
+#include <cstdint>
+#include <string>
+
+#include "message.pb.hh"
+#include "ringbuffer.hh"
+
+/// Splits the byte stream coming from a solver into length-prefixed
+/// frames and parses each of them into a message.
+///
+/// The same message object is reused for every frame: protobuf keeps the
+/// capacity of string and repeated fields across parses, so once it has
+/// seen the largest payloads, decoding allocates nothing.  Handlers may
+/// move string payloads out of the message (see Data::handleNodeCallback);
+/// only those fields are allocated again by the next parse.
+class FrameReader {
+  /// bytes received but not yet framed
+  RingBuffer _buffer;
+  /// size of the body being waited for (0 if waiting for a header)
+  uint32_t _size = 0;
+  /// a header announced more than MAX_FRAME_BYTES
+  bool _oversized = false;
+  message::Node _msg;
+
+ public:
+  /// Largest frame body accepted; the length comes from the peer, so a
+  /// bad header must not make the buffer reserve gigabytes
+  static constexpr uint32_t MAX_FRAME_BYTES = 64 << 20;
+
+  /// Whether a frame longer than MAX_FRAME_BYTES was announced; no
+  /// frames are returned after that and the connection should be closed
+  bool oversized() const { return _oversized; }
+
+  /// Where the transport should put the received bytes
+  RingBuffer& buffer() { return _buffer; }
+
+  /// Parse the next complete frame; returns nullptr if there is none yet.
+  /// The returned message is only valid until the next call.
+  message::Node* next();
+
+  static constexpr int NO_FRAME = -1;
+  static constexpr int UNKNOWN_TYPE = -2;
+
+  /// Type of the next complete frame without parsing it, or NO_FRAME
+  int peekType();
+
+  /// Append the next complete frame (header included) to `out` instead of
+  /// parsing it; returns false if there is none yet
+  bool take(std::string& out);
+
+ private:
+  /// Wait for the header of the next frame; true once its body is complete
+  bool frameReady();
+};
+
+#endif
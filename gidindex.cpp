@@ -0,0 +1,117 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "gidindex.hh"
+
+#include <cassert>
+#include <new>
+
+static_assert(sizeof(std::atomic<int32_t>) == sizeof(int32_t) &&
+              sizeof(std::atomic<uint8_t>) == 1,
+              "a slot is an array id and a source byte");
+
+GidIndex::~GidIndex() {
+    for (auto& block : _blocks) delete[] block.load();
+}
+
+DbEntry GidIndex::get(int gid) const {
+    if (gid < 0) return DbEntry();
+
+    int seg, off;
+    locate(gid, seg, off);
+    char* block = _blocks[seg].load(std::memory_order_acquire);
+    if (!block) return DbEntry();
+
+    const int n = segmentCapacity(seg);
+    const uint8_t source = sources(block, n)[off].load(std::memory_order_acquire);
+    if (source == 0) return DbEntry();
+
+    const int32_t aid = aids(block)[off].load(std::memory_order_relaxed);
+    return DbEntry(_sources[source - 1].load(std::memory_order_acquire), aid);
+}
+
+void GidIndex::set(int gid, DbEntry entry) {
+    if (gid < 0) return;
+
+    int seg, off;
+    locate(gid, seg, off);
+    const int n = segmentCapacity(seg);
+    char* block = this->block(seg);
+
+    const int source = entry ? sourceOf(entry.columns()) : 0;
+    aids(block)[off].store(entry.aid(), std::memory_order_relaxed);
+    sources(block, n)[off].store(static_cast<uint8_t>(source), std::memory_order_release);
+
+    if (gid >= _size.load(std::memory_order_relaxed)) {
+        _size.store(gid + 1, std::memory_order_release);
+    }
+}
+
+void GidIndex::reserve(int gids, EntryColumns* columns) {
+    if (gids <= 0) return;
+
+    int last, off;
+    locate(gids - 1, last, off);
+    for (int seg = 0; seg <= last; ++seg) block(seg);
+
+    sourceOf(columns);
+
+    if (gids > _size.load(std::memory_order_relaxed)) {
+        _size.store(gids, std::memory_order_release);
+    }
+}
+
+char* GidIndex::block(int seg) {
+    char* block = _blocks[seg].load(std::memory_order_relaxed);
+    if (!block) {
+        const int n = segmentCapacity(seg);
+        block = new char[(sizeof(int32_t) + 1) * n];
+        for (int i = 0; i < n; ++i) {
+            new (aids(block) + i) std::atomic<int32_t>(-1);
+            new (sources(block, n) + i) std::atomic<uint8_t>(0);
+        }
+        _blocks[seg].store(block, std::memory_order_release);
+    }
+    return block;
+}
+
+int GidIndex::sourceOf(EntryColumns* columns) {
+    const int count = _source_count.load(std::memory_order_acquire);
+    for (int i = 0; i < count; ++i) {
+        if (_sources[i].load(std::memory_order_relaxed) == columns) return i + 1;
+    }
+    /// a tree has entries of its own execution, or of the two it merges
+    assert(count < MAX_SOURCES);
+    if (count == MAX_SOURCES) return 0;
+    _sources[count].store(columns, std::memory_order_release);
+    _source_count.store(count + 1, std::memory_order_release);
+    return count + 1;
+}
+
+size_t GidIndex::bytes() const {
+    size_t total = 0;
+    for (int seg = 0; seg < MAX_SEGMENTS; ++seg) {
+        if (_blocks[seg].load(std::memory_order_relaxed)) {
+            total += (sizeof(int32_t) + 1) * segmentCapacity(seg);
+        }
+    }
+    return total;
+}
@@ -0,0 +1,99 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef GID_INDEX_HH
+#define GID_INDEX_HH
+
+#include <atomic>
+#include <cstdint>
+
+#include "entrycolumns.hh"
+
+/// Gist id -> DbEntry for the nodes of one tree.  Gids are dense
+/// NodeAllocator indices, so this is an array of array ids; as the entry
+/// may be in another execution's columns (merged trees), every slot also
+/// says whose columns, by a byte.
+///
+/// Like EntryColumns, it grows by segments of doubling size that never
+/// move, so the GUI can look entries up while the builder adds them.
+class GidIndex {
+public:
+    static constexpr int FIRST_BITS = 12;
+    static constexpr int MAX_SEGMENTS = 31 - FIRST_BITS;
+    /// different columns the entries can be in
+    static constexpr int MAX_SOURCES = 15;
+
+    GidIndex() = default;
+    ~GidIndex();
+
+    GidIndex(const GidIndex&) = delete;
+    GidIndex& operator=(const GidIndex&) = delete;
+
+    /// The entry of `gid` (false if it has none); can be called from any thread
+    DbEntry get(int gid) const;
+
+    /// Set the entry of `gid`; one thread at a time
+    void set(int gid, DbEntry entry);
+
+    /// Make room for the gids below `gids`, with entries in `columns`;
+    /// then set can be called for different ones of them from several
+    /// threads at once
+    void reserve(int gids, EntryColumns* columns);
+
+    /// One past the largest gid that was set
+    int size() const { return _size.load(std::memory_order_acquire); }
+
+    /// Bytes allocated for the slots
+    size_t bytes() const;
+
+private:
+    /// a segment of n slots is n array ids followed by n source bytes,
+    /// source 0 meaning no entry.  set stores the source byte (release)
+    /// after the array id, and get loads it (acquire) first, so a reader
+    /// never pairs a source with a stale array id.
+    std::atomic<char*> _blocks[MAX_SEGMENTS] = {};
+    /// published with release before any source byte refers to them
+    std::atomic<EntryColumns*> _sources[MAX_SOURCES] = {};
+    std::atomic<int> _source_count{0};
+    std::atomic<int> _size{0};
+
+    static int segmentCapacity(int seg) { return 1 << (seg + FIRST_BITS); }
+
+    static void locate(int gid, int& seg, int& off) {
+        const unsigned j = static_cast<unsigned>(gid) + (1u << FIRST_BITS);
+        const int bit = 31 - __builtin_clz(j);
+        seg = bit - FIRST_BITS;
+        off = static_cast<int>(j - (1u << bit));
+    }
+
+    static std::atomic<int32_t>* aids(char* block) {
+        return reinterpret_cast<std::atomic<int32_t>*>(block);
+    }
+    static std::atomic<uint8_t>* sources(char* block, int n) {
+        return reinterpret_cast<std::atomic<uint8_t>*>(block + sizeof(int32_t) * n);
+    }
+
+    int sourceOf(EntryColumns* columns);
+    /// the block of segment `seg`, allocated if needed
+    char* block(int seg);
+};
+
+#endif
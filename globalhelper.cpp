@@ -35,12 +35,56 @@ QCommandLineOption GlobalParser::test_option{
 QCommandLineOption GlobalParser::port_option{
     {"p", "port"}, "Send nodes via port <port>.", "port"};
 
+QCommandLineOption GlobalParser::local_socket_option{
+    "local_socket",
+    "Listen for local solvers on Unix domain socket <name> (default: "
+    "cpprofiler, in the temporary directory).", "name"};
+
+QCommandLineOption GlobalParser::ingest_threads{
+    "ingest_threads", "Receive from all solvers on <n> threads (default: 1).",
+    "n"};
+
+QCommandLineOption GlobalParser::decode_threads{
+    "decode_threads",
+    "Parse incoming messages on <n> threads; 0 to parse them on the "
+    "receiving threads (default: 0).", "n"};
+
+QCommandLineOption GlobalParser::max_backlog{
+    "max_backlog",
+    "Stop reading from a solver while more than <n> of its nodes wait to "
+    "be added to the tree; 0 for no limit (default: 2000000).", "n"};
+
+QCommandLineOption GlobalParser::credit_window{
+    "credit_window",
+    "Let solvers that ask for flow control send <n> nodes ahead of the "
+    "tree (default: 100000).", "n"};
+
+QCommandLineOption GlobalParser::compress_payloads{
+    "compress_payloads",
+    "Keep nogoods and info strings compressed in memory."};
+
+QCommandLineOption GlobalParser::memory_budget{
+    "memory_budget",
+    "Keep about <mb> megabytes of nodes, nogoods and info of each execution "
+    "in memory and map the rest from a file; 0 for no limit (default: 0).",
+    "mb"};
+
+QCommandLineOption GlobalParser::spill_dir{
+    "spill_dir",
+    "Create the files of --memory_budget in <dir> (default: the temporary "
+    "directory).", "dir"};
+
 QCommandLineOption GlobalParser::load_option{
     {"l", "load"}, "Load execution <file_name>.", "file_name"};
 
 QCommandLineOption GlobalParser::save_log{
     "save_log", "Save search log to <file_name>.", "file_name"};
 
+QCommandLineOption GlobalParser::save_execution{
+    "save_execution",
+    "Save the execution to <file_name> once its tree is built (with --test, "
+    "before terminating).", "file_name"};
+
 QCommandLineOption GlobalParser::auto_compare{
     "auto_compare", "Compare the first two executions"};
 
@@ -55,11 +99,26 @@ GlobalParser::GlobalParser() {
   _self = this;
 
   port_option.setDefaultValue("6565");
+  local_socket_option.setDefaultValue("cpprofiler");
+  ingest_threads.setDefaultValue("1");
+  decode_threads.setDefaultValue("0");
+  max_backlog.setDefaultValue("2000000");
+  credit_window.setDefaultValue("100000");
+  memory_budget.setDefaultValue("0");
 
   clParser.addOption(test_option);
   clParser.addOption(port_option);
+  clParser.addOption(local_socket_option);
+  clParser.addOption(ingest_threads);
+  clParser.addOption(decode_threads);
+  clParser.addOption(max_backlog);
+  clParser.addOption(credit_window);
+  clParser.addOption(compress_payloads);
+  clParser.addOption(memory_budget);
+  clParser.addOption(spill_dir);
   clParser.addOption(load_option);
   clParser.addOption(save_log);
+  clParser.addOption(save_execution);
   clParser.addOption(auto_compare);
   clParser.addOption(auto_stats);
 }
@@ -43,8 +43,17 @@ class GlobalParser {
 
   static QCommandLineOption test_option;
   static QCommandLineOption port_option;
+  static QCommandLineOption local_socket_option;
+  static QCommandLineOption ingest_threads;
+  static QCommandLineOption decode_threads;
+  static QCommandLineOption max_backlog;
+  static QCommandLineOption credit_window;
+  static QCommandLineOption compress_payloads;
+  static QCommandLineOption memory_budget;
+  static QCommandLineOption spill_dir;
   static QCommandLineOption load_option;
   static QCommandLineOption save_log;
+  static QCommandLineOption save_execution;
   static QCommandLineOption auto_compare;
 
   static QCommandLineOption auto_stats;
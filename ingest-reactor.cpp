@@ -0,0 +1,601 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "ingest-reactor.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
+static std::string oversizedReason() {
+    return "frame larger than " + std::to_string(FrameReader::MAX_FRAME_BYTES) +
+           " bytes";
+}
+
+static void setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+/// ************************
+/// *** IngestConnection ***
+/// ************************
+
+IngestConnection::IngestConnection(int fd) : _fd(fd) {
+    setNonBlocking(_fd);
+}
+
+IngestConnection::~IngestConnection() {
+    ::close(_fd);
+
+    delete _chunk;
+    for (auto& chunk : _decoded) delete chunk.second;
+    for (auto chunk : _spare) delete chunk;
+}
+
+IngestConnection::Status
+IngestConnection::serve() {
+    if (_eof) return closed();
+
+    const Status status = readAvailable();
+    // don't keep a partial chunk back until more data arrives
+    if (status != Status::CLOSED) submitChunk();
+    return status;
+}
+
+IngestConnection::Status
+IngestConnection::readAvailable() {
+    RingBuffer& buffer = _reader.buffer();
+    size_t budget = READ_BUDGET;
+
+    if (!_out.empty()) flushOut();
+
+    while (budget > 0) {
+        if (!readable()) return Status::PAUSED;
+
+        ssize_t n;
+        if (_shm) {
+            // the frames are in the ring, these are only wake-up bytes
+            char bells[64];
+            n = ::read(_fd, bells, sizeof(bells));
+        } else {
+            // Read straight into the free part of the ring buffer.
+            uint64_t space;
+            char* dst = buffer.writeSpan(space);
+            if (space == 0) {
+                // Only possible if a single frame is larger than the buffer,
+                // in which case the reader has already reserved room for it.
+                buffer.reserve(buffer.capacity() * 2);
+                continue;
+            }
+            n = ::read(_fd, dst, std::min<uint64_t>(space, budget));
+            if (n > 0) {
+                buffer.commit(n);
+                budget -= n;
+                stampReceived();
+                processFrames();
+                if (_reader.oversized()) {
+                    dropPeer(oversizedReason());
+                    return closed();
+                }
+                continue;
+            }
+        }
+
+        if (n == 0) return closed();
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            return closed();
+        }
+    }
+
+    if (_shm && !drainRing(budget)) {
+        return readable() ? Status::BUSY : Status::PAUSED;
+    }
+    return Status::OPEN;
+}
+
+void
+IngestConnection::sendMessage(const message::Node& msg) {
+    const uint32_t size = msg.ByteSizeLong();
+    _out.append(reinterpret_cast<const char*>(&size), 4);
+    msg.AppendToString(&_out);
+    flushOut();
+}
+
+void
+IngestConnection::flushOut() {
+    size_t sent = 0;
+    while (sent < _out.size()) {
+        ssize_t n = ::send(_fd, _out.data() + sent, _out.size() - sent,
+                           MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;  // full (or broken, which the read side sees)
+        sent += n;
+    }
+    _out.erase(0, sent);
+}
+
+// One clock read per read(2): the messages decoded inline are handled
+// right away, those of a chunk when it is committed.
+void
+IngestConnection::stampReceived() {
+    _received = std::chrono::steady_clock::now();
+    if (!_decode) onReceived(_received);
+}
+
+void
+IngestConnection::dropPeer(const std::string& reason) {
+    std::cerr << reason << ", closing the connection\n";
+    ::shutdown(_fd, SHUT_RDWR);
+    _shm.reset();
+}
+
+void
+IngestConnection::processFrames() {
+    while (!_shm) {
+        if (_decode) {
+            const int type = _reader.peekType();
+            if (type == FrameReader::NO_FRAME) return;
+            if (type != message::Node::ATTACH_SHM) {
+                chunkFrame();
+                continue;
+            }
+        }
+
+        message::Node* msg = _reader.next();
+        if (!msg) return;
+
+        if (msg->type() == message::Node::ATTACH_SHM) {
+            attachRing(msg->label());
+        } else {
+            handleMessage(*msg);
+        }
+    }
+
+    // anything after ATTACH_SHM on the socket is a wake-up byte
+    _reader.buffer().consume(_reader.buffer().size());
+}
+
+void
+IngestConnection::processRingFrames() {
+    if (_decode) {
+        while (_reader.peekType() != FrameReader::NO_FRAME) chunkFrame();
+        return;
+    }
+
+    while (message::Node* msg = _reader.next()) {
+        handleMessage(*msg);
+    }
+}
+
+void
+IngestConnection::chunkFrame() {
+    if (!_chunk) {
+        if (_spare.empty()) {
+            _chunk = new FrameChunk;
+        } else {
+            _chunk = _spare.back();
+            _spare.pop_back();
+        }
+        _chunk->connection = this;
+        _chunk->reactor = _reactor;
+        _chunk->received = _received;
+    }
+
+    _reader.take(_chunk->frames);
+    if (_chunk->frames.size() >= CHUNK_BYTES) submitChunk();
+}
+
+void
+IngestConnection::submitChunk() {
+    if (!_chunk) return;
+    _chunk->seq = _next_seq++;
+    ++_in_flight;
+    _decode->submit(_chunk);
+    _chunk = nullptr;
+}
+
+void
+IngestConnection::commit(FrameChunk* chunk) {
+    _decoded[chunk->seq] = chunk;
+
+    auto it = _decoded.begin();
+    while (it != _decoded.end() && it->first == _commit_seq) {
+        FrameChunk* next = it->second;
+        onReceived(next->received);
+        for (int i = 0; i < next->count; ++i) {
+            handleMessage(next->messages[i]);
+        }
+        next->clear();
+        _spare.push_back(next);
+
+        ++_commit_seq;
+        --_in_flight;
+        it = _decoded.erase(it);
+    }
+}
+
+void
+IngestConnection::attachRing(const std::string& name) {
+    std::unique_ptr<shm_ring::Reader> ring{new shm_ring::Reader};
+    if (!ring->open(name)) {
+        std::cerr << "can't open shared memory ring " << name << "\n";
+        ::shutdown(_fd, SHUT_RDWR);
+        return;
+    }
+    // the mapping stays valid; this way the name does not outlive
+    // a solver that crashes
+    shm_unlink(name.c_str());
+
+    std::cerr << "receiving through shared memory ring " << name
+              << " of " << ring->capacity() << " bytes\n";
+    _shm = std::move(ring);
+}
+
+// Move what the solver has published in the shared memory ring through
+// the frame reader.  Returns true once the ring is empty and the writer
+// has been asked for a wake-up byte.
+bool
+IngestConnection::drainRing(size_t budget) {
+    RingBuffer& buffer = _reader.buffer();
+
+    do {
+        while (_shm->size() > 0) {
+            if (budget == 0 || !readable()) return false;
+
+            uint64_t space;
+            char* dst = buffer.writeSpan(space);
+            if (space == 0) {
+                buffer.reserve(buffer.capacity() * 2);
+                continue;
+            }
+            uint64_t n = _shm->read(dst, std::min<uint64_t>(space, budget));
+            if (_shm->corrupt()) {
+                dropPeer("shared memory ring holds more than its capacity");
+                return true;
+            }
+            buffer.commit(n);
+            budget -= n;
+
+            stampReceived();
+            processRingFrames();
+            if (_reader.oversized()) {
+                dropPeer(oversizedReason());
+                return true;
+            }
+        }
+    } while (!_shm->prepareToSleep());
+
+    return true;
+}
+
+// The peer is gone.  Everything it sent has to be handled before
+// onClosed, so while the ring still holds data or chunks are in flight,
+// the connection stays around (paused) and this is called again.
+IngestConnection::Status
+IngestConnection::closed() {
+    _eof = true;
+    const bool drained = !_shm || drainRing(SIZE_MAX);
+    submitChunk();
+    if (!drained || _in_flight > 0) return Status::PAUSED;
+
+    onClosed();
+    return Status::CLOSED;
+}
+
+/// *********************
+/// *** IngestReactor ***
+/// *********************
+
+IngestReactor::IngestReactor(DecodePool* decode) : _decode(decode) {
+    if (pipe(_wake) != 0) {
+        std::cerr << "can't create a pipe for the ingest reactor\n";
+        abort();
+    }
+    setNonBlocking(_wake[0]);
+
+#ifdef __linux__
+    _poll_fd = epoll_create1(0);
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.ptr = nullptr;  /// the wake-up pipe
+    epoll_ctl(_poll_fd, EPOLL_CTL_ADD, _wake[0], &ev);
+#endif
+}
+
+IngestReactor::~IngestReactor() {
+    stop();
+
+    acceptPending();
+    for (auto chunk : _decoded) delete chunk;
+    for (auto connection : _connections) delete connection;
+
+#ifdef __linux__
+    ::close(_poll_fd);
+#endif
+    ::close(_wake[0]);
+    ::close(_wake[1]);
+}
+
+void
+IngestReactor::start() {
+    _thread = std::thread(&IngestReactor::run, this);
+}
+
+void
+IngestReactor::stop() {
+    _quit = true;
+    if (_thread.joinable()) {
+        const char c = 0;
+        if (::write(_wake[1], &c, 1) < 0) {}
+        _thread.join();
+    }
+}
+
+void
+IngestReactor::decoded(FrameChunk* chunk) {
+    {
+        std::lock_guard<std::mutex> lock(_pending_mutex);
+        _decoded.push_back(chunk);
+    }
+    const char c = 0;
+    if (::write(_wake[1], &c, 1) < 0) {
+        std::cerr << "can't wake up the ingest reactor\n";
+    }
+}
+
+void
+IngestReactor::commitDecoded() {
+    std::vector<FrameChunk*> decoded;
+    {
+        std::lock_guard<std::mutex> lock(_pending_mutex);
+        decoded.swap(_decoded);
+    }
+    for (auto chunk : decoded) {
+        IngestConnection* connection = chunk->connection;
+        connection->commit(chunk);
+        resume(connection);
+    }
+}
+
+void
+IngestReactor::resume(IngestConnection* connection) {
+    auto it = std::find(_paused.begin(), _paused.end(), connection);
+    if (it == _paused.end() || !connection->readable()) return;
+
+    _paused.erase(it);
+    watch(connection);
+    serve(connection);
+}
+
+void
+IngestReactor::add(IngestConnection* connection) {
+    {
+        std::lock_guard<std::mutex> lock(_pending_mutex);
+        _pending.push_back(connection);
+    }
+    ++_count;
+    const char c = 0;
+    if (::write(_wake[1], &c, 1) < 0) {
+        std::cerr << "can't wake up the ingest reactor\n";
+    }
+}
+
+void
+IngestReactor::acceptPending() {
+    std::vector<IngestConnection*> pending;
+    {
+        std::lock_guard<std::mutex> lock(_pending_mutex);
+        pending.swap(_pending);
+    }
+    for (auto connection : pending) {
+        connection->_decode = _decode;
+        connection->_reactor = this;
+        _connections.insert(connection);
+        watch(connection);
+    }
+}
+
+void
+IngestReactor::watch(IngestConnection* connection) {
+#ifdef __linux__
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLRDHUP;
+    ev.data.ptr = connection;
+    epoll_ctl(_poll_fd, EPOLL_CTL_ADD, connection->fd(), &ev);
+#else
+    (void)connection;
+#endif
+}
+
+void
+IngestReactor::unwatch(IngestConnection* connection) {
+#ifdef __linux__
+    epoll_ctl(_poll_fd, EPOLL_CTL_DEL, connection->fd(), nullptr);
+#else
+    (void)connection;
+#endif
+}
+
+void
+IngestReactor::serve(IngestConnection* connection) {
+    const auto status = connection->serve();
+    if (status != IngestConnection::Status::CLOSED &&
+        connection->needsTicks()) {
+        _ticking = true;
+    }
+
+    switch (status) {
+    case IngestConnection::Status::OPEN:
+        break;
+    case IngestConnection::Status::BUSY:
+        _busy.push_back(connection);
+        break;
+    case IngestConnection::Status::PAUSED:
+        unwatch(connection);
+        _paused.push_back(connection);
+        break;
+    case IngestConnection::Status::CLOSED:
+        unwatch(connection);
+        _connections.erase(connection);
+        --_count;
+        delete connection;
+        break;
+    }
+}
+
+bool
+IngestReactor::tick() {
+    bool ticking = false;
+    for (auto connection : _connections) {
+        if (connection->needsTicks()) {
+            connection->tick();
+            ticking = true;
+        }
+    }
+
+    std::vector<IngestConnection*> paused = _paused;
+    for (auto connection : paused) resume(connection);
+
+    return ticking || !_paused.empty();
+}
+
+void
+IngestReactor::run() {
+    using clock = std::chrono::steady_clock;
+
+    std::vector<IngestConnection*> ready;
+    auto next_tick = clock::now();
+
+    while (!_quit) {
+        // don't block while some connection still has data in its ring,
+        // and only wake up periodically if some connection needs that
+        int timeout = -1;
+        if (!_busy.empty()) {
+            timeout = 0;
+        } else if (_ticking || !_paused.empty()) {
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          next_tick - clock::now()).count();
+            timeout = std::max<int>(ms, 0);
+        }
+        ready.clear();
+        bool woken = false;
+
+#ifdef __linux__
+        static constexpr int MAX_EVENTS = 64;
+        epoll_event events[MAX_EVENTS];
+        int n = epoll_wait(_poll_fd, events, MAX_EVENTS, timeout);
+        for (int i = 0; i < n; ++i) {
+            auto connection = static_cast<IngestConnection*>(events[i].data.ptr);
+            if (connection) {
+                ready.push_back(connection);
+            } else {
+                woken = true;
+            }
+        }
+#else
+        std::vector<pollfd> fds;
+        std::vector<IngestConnection*> polled;
+        fds.push_back(pollfd{_wake[0], POLLIN, 0});
+        for (auto connection : _connections) {
+            if (std::find(_paused.begin(), _paused.end(), connection) !=
+                _paused.end()) continue;
+            fds.push_back(pollfd{connection->fd(), POLLIN, 0});
+            polled.push_back(connection);
+        }
+        if (poll(fds.data(), fds.size(), timeout) > 0) {
+            woken = fds[0].revents != 0;
+            for (size_t i = 1; i < fds.size(); ++i) {
+                if (fds[i].revents != 0) ready.push_back(polled[i - 1]);
+            }
+        }
+#endif
+
+        if (woken) {
+            char buf[64];
+            while (::read(_wake[0], buf, sizeof(buf)) > 0) {}
+            if (_quit) break;
+            acceptPending();
+            commitDecoded();
+        }
+
+        std::vector<IngestConnection*> busy;
+        busy.swap(_busy);
+
+        for (auto connection : ready) {
+            // a connection may be both ready and busy; serve it once
+            auto it = std::find(busy.begin(), busy.end(), connection);
+            if (it != busy.end()) busy.erase(it);
+            serve(connection);
+        }
+        for (auto connection : busy) serve(connection);
+
+        if (_ticking || !_paused.empty()) {
+            const auto now = clock::now();
+            if (now >= next_tick) {
+                _ticking = tick();
+                next_tick = now + std::chrono::milliseconds(
+                                      IngestConnection::TICK_MS);
+            }
+        }
+    }
+}
+
+/// ******************
+/// *** IngestPool ***
+/// ******************
+
+IngestPool::IngestPool(int threads, int decode_threads) {
+    if (decode_threads > 0) _decode.reset(new DecodePool(decode_threads));
+
+    for (int i = 0; i < std::max(threads, 1); ++i) {
+        _reactors.emplace_back(new IngestReactor(_decode.get()));
+        _reactors.back()->start();
+    }
+}
+
+// The reactors submit to the pool and the pool hands chunks back to the
+// reactors: stop the reactor threads, then the workers, then destroy the
+// reactors (with whatever chunks were handed back meanwhile).
+IngestPool::~IngestPool() {
+    for (auto& reactor : _reactors) reactor->stop();
+    _decode.reset();
+    _reactors.clear();
+}
+
+void
+IngestPool::add(IngestConnection* connection) {
+    _reactors[_next++ % _reactors.size()]->add(connection);
+}
@@ -0,0 +1,237 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef INGEST_REACTOR_HH
+#define INGEST_REACTOR_HH
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "decode-pool.hh"
+#include "framereader.hh"
+#include "libs/shm_ring.hh"
+
+/// One solver connection (TCP or Unix domain socket) served by an
+/// IngestReactor.  Frames the incoming bytes and passes every message to
+/// handleMessage; ATTACH_SHM is dealt with here, so subclasses only ever
+/// see the messages themselves, whichever way they came.
+///
+/// With a DecodePool, the frames are parsed by the pool's workers instead
+/// of the reactor thread; handleMessage is still called on the reactor
+/// thread and in the original order, but runs of NODE messages arrive
+/// merged into NODE_BATCH messages.
+class IngestConnection {
+ public:
+  /// Result of serving a connection once
+  enum class Status {
+    OPEN,    /// wait for the socket to become readable again
+    BUSY,    /// more data is ready (shared memory ring), call again soon
+    PAUSED,  /// don't read until readable() returns true
+    CLOSED   /// the peer is gone; the connection can be destroyed
+  };
+
+  /// Takes ownership of the (connected) socket `fd`
+  explicit IngestConnection(int fd);
+  virtual ~IngestConnection();
+
+  IngestConnection(const IngestConnection&) = delete;
+  IngestConnection& operator=(const IngestConnection&) = delete;
+
+  int fd() const { return _fd; }
+
+  /// Read and handle what is available, at most READ_BUDGET bytes so that
+  /// one busy solver does not starve the others sharing the reactor
+  Status serve();
+
+  /// Whether reading should stop for now (backpressure); the socket is
+  /// left alone, so the solver blocks once the kernel buffers are full
+  virtual bool throttled() { return false; }
+
+  /// Whether serve() may read: not throttled, and not too many chunks
+  /// waiting to be decoded and committed
+  bool readable() {
+    return _in_flight < MAX_CHUNKS_IN_FLIGHT && !throttled();
+  }
+
+  /// Called about every TICK_MS while needsTicks() is true
+  virtual void tick() {}
+  virtual bool needsTicks() const { return false; }
+
+  static constexpr size_t READ_BUDGET = 1 << 20;
+  static constexpr int TICK_MS = 10;
+
+  /// frames are handed to the DecodePool in chunks of about this size
+  static constexpr size_t CHUNK_BYTES = 64 << 10;
+  static constexpr int MAX_CHUNKS_IN_FLIGHT = 16;
+
+ protected:
+  virtual void handleMessage(message::Node& msg) = 0;
+  /// The messages handled next were received at `when` (monotonic); called
+  /// once per read from the socket or ring, or per decoded chunk, so that
+  /// nobody has to read the clock per message
+  virtual void onReceived(std::chrono::steady_clock::time_point) {}
+  /// The peer closed the connection (after everything it sent was handled)
+  virtual void onClosed() {}
+
+  /// Send a control message back to the solver.  Never blocks: what the
+  /// socket does not take now is kept and sent on later calls.
+  void sendMessage(const message::Node& msg);
+
+ private:
+  int _fd;
+  FrameReader _reader;
+
+  /// outgoing bytes the socket has not accepted yet
+  std::string _out;
+  void flushOut();
+
+  /// Shared memory ring announced by ATTACH_SHM; once attached, bytes
+  /// on the socket are just wake-ups
+  std::unique_ptr<shm_ring::Reader> _shm;
+
+  /// set by IngestReactor if frames are decoded by a pool
+  DecodePool* _decode = nullptr;
+  IngestReactor* _reactor = nullptr;
+  friend class IngestReactor;
+
+  /// chunk being filled, chunks given to the pool, decoded chunks waiting
+  /// for their predecessors, and spare ones
+  FrameChunk* _chunk = nullptr;
+  uint64_t _next_seq = 0;
+  uint64_t _commit_seq = 0;
+  int _in_flight = 0;
+  std::map<uint64_t, FrameChunk*> _decoded;
+  std::vector<FrameChunk*> _spare;
+
+  /// when the bytes being framed were read
+  std::chrono::steady_clock::time_point _received;
+  void stampReceived();
+
+  /// the peer is gone, but chunks were still in flight
+  bool _eof = false;
+
+  Status readAvailable();
+  /// Stop reading from a peer that broke the protocol (a frame larger
+  /// than FrameReader::MAX_FRAME_BYTES, a ring head past its capacity):
+  /// the socket is shut down and the ring dropped, so the connection
+  /// goes on to closed()
+  void dropPeer(const std::string& reason);
+  void processFrames();
+  /// frames read from the shared memory ring
+  void processRingFrames();
+  /// move the next frame into the current chunk
+  void chunkFrame();
+  void submitChunk();
+  /// Handle the messages of a decoded chunk (and of those that were
+  /// waiting for it); on the reactor thread
+  void commit(FrameChunk* chunk);
+
+  void attachRing(const std::string& name);
+  /// returns false if the budget ran out before the ring was empty
+  bool drainRing(size_t budget);
+  Status closed();
+};
+
+/// Serves many connections on one thread, waiting on all of their sockets
+/// at once (epoll on Linux, poll elsewhere) instead of running a thread
+/// and an event loop per connection.
+class IngestReactor {
+ public:
+  /// With `decode`, connections have their frames decoded by that pool
+  explicit IngestReactor(DecodePool* decode = nullptr);
+  /// Stops the thread and destroys the connections it still serves
+  ~IngestReactor();
+
+  IngestReactor(const IngestReactor&) = delete;
+  IngestReactor& operator=(const IngestReactor&) = delete;
+
+  void start();
+  /// Stop the thread (the connections stay until destruction)
+  void stop();
+
+  /// Hand over a connection (takes ownership); can be called from any thread
+  void add(IngestConnection* connection);
+
+  /// number of connections being served
+  int size() const { return _count; }
+
+  /// A chunk is decoded; called by DecodePool workers
+  void decoded(FrameChunk* chunk);
+
+ private:
+  std::thread _thread;
+  std::atomic<bool> _quit{false};
+  std::atomic<int> _count{0};
+
+  /// epoll instance (Linux only)
+  int _poll_fd = -1;
+  /// self-pipe used to wake the reactor up for new connections / quitting
+  int _wake[2] = {-1, -1};
+
+  DecodePool* _decode;
+
+  std::mutex _pending_mutex;
+  std::vector<IngestConnection*> _pending;
+  std::vector<FrameChunk*> _decoded;
+
+  /// owned by the reactor thread
+  std::unordered_set<IngestConnection*> _connections;
+  std::vector<IngestConnection*> _busy;
+  /// throttled connections, not watched until they may read again
+  std::vector<IngestConnection*> _paused;
+  /// whether some connection asked for ticks
+  bool _ticking = false;
+
+  void run();
+  /// ticks the connections that want it, resumes paused ones;
+  /// returns whether the reactor has to keep waking up for this
+  bool tick();
+  void acceptPending();
+  void commitDecoded();
+  /// serve a paused connection again if it is readable
+  void resume(IngestConnection* connection);
+  void serve(IngestConnection* connection);
+  void watch(IngestConnection* connection);
+  void unwatch(IngestConnection* connection);
+};
+
+/// A fixed number of reactors; connections are spread round-robin.
+/// With `decode_threads` > 0 they share a DecodePool of that many threads.
+class IngestPool {
+  std::unique_ptr<DecodePool> _decode;
+  std::vector<std::unique_ptr<IngestReactor>> _reactors;
+  std::atomic<unsigned> _next{0};
+
+ public:
+  explicit IngestPool(int threads = 1, int decode_threads = 0);
+  ~IngestPool();
+
+  void add(IngestConnection* connection);
+};
+
+#endif
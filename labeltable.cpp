@@ -0,0 +1,68 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "labeltable.hh"
+
+LabelTable::LabelTable() {
+  auto it = ids.emplace(std::string(), NO_LABEL).first;
+  strings.push_back(&it->first);
+}
+
+int LabelTable::intern(const std::string& label) {
+  if (label.empty()) return NO_LABEL;
+
+  QMutexLocker locker(&mutex);
+
+  auto it = ids.find(label);
+  if (it != ids.end()) return it->second;
+
+  const int id = strings.size();
+  it = ids.emplace(label, id).first;
+  strings.push_back(&it->first);
+  return id;
+}
+
+std::string LabelTable::get(int id) const {
+  QMutexLocker locker(&mutex);
+  if (id < 0 || id >= static_cast<int>(strings.size())) return std::string();
+  return *strings[id];
+}
+
+int LabelTable::size() const {
+  QMutexLocker locker(&mutex);
+  return strings.size();
+}
+
+size_t LabelTable::bytes() const {
+  QMutexLocker locker(&mutex);
+  /// a map node holds the string, the id and a link; long strings have
+  /// their characters elsewhere
+  static constexpr size_t NODE_BYTES =
+      sizeof(std::pair<const std::string, int>) + 2 * sizeof(void*);
+  static constexpr size_t SSO_CHARS = 15;
+
+  size_t total = strings.capacity() * sizeof(strings[0]) +
+                 ids.bucket_count() * sizeof(void*) + ids.size() * NODE_BYTES;
+  for (const auto& entry : ids) {
+    if (entry.first.size() > SSO_CHARS) total += entry.first.capacity() + 1;
+  }
+  return total;
+}
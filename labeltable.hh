@@ -0,0 +1,60 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef LABELTABLE_HH
+#define LABELTABLE_HH
+
+#include <QMutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// Interned branching labels.  Labels like `x[17]=3` repeat across millions
+/// of nodes, so DbEntry only stores an id into this table.
+///
+/// There is one table for the whole process (see `Data::labels()`): merged
+/// trees point at entries of other executions, and equal ids mean equal
+/// labels regardless of the execution an entry comes from.
+class LabelTable {
+  mutable QMutex mutex;
+  /// the strings live in the map's nodes, which never move
+  std::unordered_map<std::string, int> ids;
+  std::vector<const std::string*> strings;
+
+ public:
+  /// id of the empty label
+  static constexpr int NO_LABEL = 0;
+
+  LabelTable();
+
+  /// Id of `label`, adding it if it is new; can be called from any thread
+  int intern(const std::string& label);
+
+  /// Label with id `id` (empty for unknown ids)
+  std::string get(int id) const;
+
+  int size() const;
+
+  /// Bytes taken by the table (estimated for the map)
+  size_t bytes() const;
+};
+
+#endif
@@ -57,7 +57,10 @@ LayoutCursor::processCurrentNode(void) {
         } else if (false && currentNode->getNumberOfChildren() < 1) { /// TODO: ask Guido
             currentNode->setShape(Shape::leaf);
         } else {
+            const size_t before = currentNode->shapeBytes();
             currentNode->computeShape(na);
+            na.countShapeBytes(static_cast<long long>(currentNode->shapeBytes()) -
+                               static_cast<long long>(before));
         }
         currentNode->setDirty(false);
     }
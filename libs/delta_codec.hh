@@ -0,0 +1,119 @@
+#ifndef CPPROFILER_DELTA_CODEC_HH
+#define CPPROFILER_DELTA_CODEC_HH
+
+/// DELTA encoding of NodeBatch columns (see message.proto).
+///
+/// Nodes of one solver thread have nearly consecutive ids, parents close to
+/// their children and increasing timestamps, so sid, pid and time are sent
+/// as small differences, which the zigzag varints of sint32/sint64 store in
+/// a byte or two.  Both sides keep the previous sid and time of every
+/// thread for the whole connection.  Differences of sids are taken
+/// modulo 2^32, so ids far apart (or -1 next to INT32_MAX) cannot
+/// overflow and still come back exactly.
+///
+///   delta_codec::Encoder<message::NodeBatch> enc;    // solver side
+///   ... fill batch.sid/pid/time as usual ...; enc.encode(batch);
+///
+///   delta_codec::Decoder<message::NodeBatch> dec;    // profiler side
+///   dec.decode(batch);  // sid/pid/time are back
+///
+/// Header-only; used by the profiler and by solver-side code alike.
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace delta_codec {
+
+/// a - b and a + b modulo 2^32
+inline int32_t wrapSub(int32_t a, int32_t b) {
+  return static_cast<int32_t>(static_cast<uint32_t>(a) - static_cast<uint32_t>(b));
+}
+inline int32_t wrapAdd(int32_t a, int32_t b) {
+  return static_cast<int32_t>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b));
+}
+
+/// Previous node of one thread
+struct ThreadState {
+  int32_t sid = -1;
+  uint64_t time = 0;
+};
+
+template <typename Batch>
+class Encoder {
+  std::unordered_map<int32_t, ThreadState> _threads;
+
+ public:
+  /// Replace the sid, pid and time columns of `batch` by their deltas
+  void encode(Batch& batch) {
+    const int n = batch.sid_size();
+    batch.clear_sid_delta();
+    batch.clear_pid_delta();
+    batch.clear_time_delta();
+
+    for (int i = 0; i < n; ++i) {
+      const int32_t tid = i < batch.thread_id_size() ? batch.thread_id(i) : 0;
+      ThreadState& prev = _threads[tid];
+
+      const int32_t sid = batch.sid(i);
+      const int32_t pid = i < batch.pid_size() ? batch.pid(i) : -1;
+      const uint64_t time = i < batch.time_size() ? batch.time(i) : prev.time;
+
+      batch.add_sid_delta(wrapSub(wrapSub(sid, prev.sid), 1));
+      batch.add_pid_delta(wrapSub(sid, pid));
+      batch.add_time_delta(static_cast<int64_t>(time - prev.time));
+
+      prev.sid = sid;
+      prev.time = time;
+    }
+
+    batch.clear_sid();
+    batch.clear_pid();
+    batch.clear_time();
+  }
+};
+
+template <typename Batch>
+class Decoder {
+  std::unordered_map<int32_t, ThreadState> _threads;
+
+ public:
+  /// Restore the sid, pid and time columns of a DELTA batch;
+  /// a batch without deltas is left alone
+  void decode(Batch& batch) {
+    const int n = batch.sid_delta_size();
+    if (n == 0) return;
+
+    batch.clear_sid();
+    batch.clear_pid();
+    batch.clear_time();
+    batch.mutable_sid()->Reserve(n);
+    batch.mutable_pid()->Reserve(n);
+    batch.mutable_time()->Reserve(n);
+
+    for (int i = 0; i < n; ++i) {
+      const int32_t tid = i < batch.thread_id_size() ? batch.thread_id(i) : 0;
+      ThreadState& prev = _threads[tid];
+
+      const int32_t sid = wrapAdd(wrapAdd(prev.sid, 1), batch.sid_delta(i));
+      const int32_t pid = i < batch.pid_delta_size()
+                              ? wrapSub(sid, batch.pid_delta(i)) : -1;
+      const uint64_t time =
+          prev.time + (i < batch.time_delta_size() ? batch.time_delta(i) : 0);
+
+      batch.add_sid(sid);
+      batch.add_pid(pid);
+      batch.add_time(time);
+
+      prev.sid = sid;
+      prev.time = time;
+    }
+
+    batch.clear_sid_delta();
+    batch.clear_pid_delta();
+    batch.clear_time_delta();
+  }
+};
+
+}  // namespace delta_codec
+
+#endif
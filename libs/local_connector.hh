@@ -0,0 +1,178 @@
+#ifndef CPPROFILER_LOCAL_CONNECTOR_HH
+#define CPPROFILER_LOCAL_CONNECTOR_HH
+
+/// Solver-side helper for profiling on the same machine.
+///
+/// Connects to the profiler's Unix domain socket (by default
+/// $TMPDIR/cpprofiler, see `--local_socket`) and sends the usual
+/// length-prefixed frames.  Optionally it creates a shared memory ring and
+/// announces it with an ATTACH_SHM message; after that, frames are copied
+/// into the ring and the socket only carries occasional wake-up bytes.
+///
+///   LocalConnector c;
+///   c.connect<message::Node>("/tmp/cpprofiler", true);
+///   c.send(start_msg); c.send(node_msg); ... c.send(done_msg);
+///
+/// If the START message has `flow_control` set, the connector honours the
+/// CREDIT messages of the profiler: `send` blocks (reading the socket)
+/// while the nodes sent so far have used up the credit.
+///
+/// Header-only; needs the generated message.pb.hh and -lrt on older glibc.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "shm_ring.hh"
+
+class LocalConnector {
+  int _fd = -1;
+  shm_ring::Writer _ring;
+  bool _use_ring = false;
+  std::string _frame;
+
+  bool _flow_control = false;
+  long long _sent = 0;    /// nodes sent since START
+  long long _credit = 0;  /// largest credit received
+
+  bool readAll(char* p, size_t n) {
+    while (n > 0) {
+      ssize_t r = ::read(_fd, p, n);
+      if (r <= 0) return false;
+      p += r;
+      n -= r;
+    }
+    return true;
+  }
+
+  /// Block until the profiler grants more credit
+  template <typename Message>
+  bool waitForCredit() {
+    std::string body;
+    Message msg;
+    while (_sent >= _credit) {
+      uint32_t size;
+      if (!readAll(reinterpret_cast<char*>(&size), 4)) return false;
+      body.resize(size);
+      if (!readAll(&body[0], size) || !msg.ParseFromString(body)) return false;
+      if (msg.type() == Message::CREDIT) {
+        _credit = std::max<long long>(_credit, msg.credit());
+      }
+    }
+    return true;
+  }
+
+  bool writeAll(const char* p, size_t n) {
+    while (n > 0) {
+      ssize_t w = ::write(_fd, p, n);
+      if (w <= 0) return false;
+      p += w;
+      n -= w;
+    }
+    return true;
+  }
+
+  /// Write into the ring, ringing the doorbell if the reader asked for it
+  bool ringWrite(const char* p1, uint64_t n1, const char* p2 = nullptr,
+                 uint64_t n2 = 0) {
+    if (!_ring.write(p1, n1, p2, n2)) return true;
+    const char bell = 1;
+    return writeAll(&bell, 1);
+  }
+
+  bool socketFrame(const std::string& body) {
+    const uint32_t size = body.size();
+    return writeAll(reinterpret_cast<const char*>(&size), 4) &&
+           writeAll(body.data(), body.size());
+  }
+
+ public:
+  static constexpr uint64_t DEFAULT_RING_CAPACITY = 16 << 20;
+
+  ~LocalConnector() { disconnect(); }
+
+  /// Connect to the socket at `path`; with `use_ring`, set up a shared
+  /// memory ring of (at least) `ring_capacity` bytes for the frames
+  template <typename Message>
+  bool connect(const std::string& path, bool use_ring,
+               uint64_t ring_capacity = DEFAULT_RING_CAPACITY) {
+    _fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (_fd < 0) return false;
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) return false;
+    path.copy(addr.sun_path, path.size());
+    if (::connect(_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+      disconnect();
+      return false;
+    }
+
+    if (!use_ring) return true;
+
+    static int counter = 0;
+    const std::string name = "/cpprofiler-" + std::to_string(getpid()) +
+                             "-" + std::to_string(counter++);
+    if (!_ring.create(name, ring_capacity)) return true;  // socket only
+
+    Message attach;
+    attach.set_type(Message::ATTACH_SHM);
+    attach.set_label(name);
+    attach.SerializeToString(&_frame);
+    _use_ring = socketFrame(_frame);
+    return _use_ring;
+  }
+
+  /// Send one message as a length-prefixed frame
+  template <typename Message>
+  bool send(const Message& msg) {
+    if (msg.type() == Message::START && msg.restart_id() <= 0) {
+      _flow_control = msg.flow_control();
+      _sent = 0;
+      _credit = 0;
+    } else if (_flow_control) {
+      long long nodes = 0;
+      if (msg.type() == Message::NODE) nodes = 1;
+      /// DELTA batches carry sid_delta instead of sid
+      if (msg.type() == Message::NODE_BATCH) {
+        nodes = std::max(msg.batch().sid_size(), msg.batch().sid_delta_size());
+      }
+      if (nodes > 0) {
+        if (!waitForCredit<Message>()) return false;
+        _sent += nodes;
+      }
+    }
+
+    msg.SerializeToString(&_frame);
+
+    if (!_use_ring) return socketFrame(_frame);
+
+    const uint32_t size = _frame.size();
+    const char* header = reinterpret_cast<const char*>(&size);
+
+    if (_frame.size() + 4 <= _ring.capacity()) {
+      return ringWrite(header, 4, _frame.data(), _frame.size());
+    }
+
+    /// larger than the ring: the reader reassembles it from the pieces
+    if (!ringWrite(header, 4)) return false;
+    const uint64_t piece = _ring.capacity() / 2;
+    for (uint64_t off = 0; off < _frame.size(); off += piece) {
+      const uint64_t n = std::min<uint64_t>(piece, _frame.size() - off);
+      if (!ringWrite(_frame.data() + off, n)) return false;
+    }
+    return true;
+  }
+
+  void disconnect() {
+    if (_fd >= 0) ::close(_fd);
+    _fd = -1;
+  }
+};
+
+#endif
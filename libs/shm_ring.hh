@@ -0,0 +1,300 @@
+#ifndef CPPROFILER_SHM_RING_HH
+#define CPPROFILER_SHM_RING_HH
+
+/// Single-producer/single-consumer byte ring in POSIX shared memory.
+///
+/// Shared between the profiler (reader) and the solver-side connector
+/// (writer, see local_connector.hh), so it depends on nothing but POSIX.
+/// The ring carries the same length-prefixed frames as the sockets do.
+///
+/// Wake-ups go through the Unix domain socket the ring was announced on:
+/// the reader raises `reader_waiting` before it goes to sleep, and the
+/// writer sends a single "doorbell" byte on the socket if it sees the flag.
+///
+/// The other way round (the ring is full) the socket carries CREDIT
+/// messages, so the writer sleeps on a futex on `room_seq` instead: it
+/// raises `writer_waiting`, and the reader bumps `room_seq` and wakes it
+/// once it has made room.  Where there are no futexes the writer naps.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace shm_ring {
+
+static constexpr uint32_t MAGIC = 0x43505052;  // "CPPR"
+static constexpr uint32_t VERSION = 2;
+
+struct Header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t capacity;  /// size of the data area, a power of two
+
+  /// total bytes published by the writer
+  alignas(64) std::atomic<uint64_t> head;
+  /// total bytes consumed by the reader
+  alignas(64) std::atomic<uint64_t> tail;
+  /// set by the reader when it needs a doorbell for new data
+  alignas(64) std::atomic<uint32_t> reader_waiting;
+  /// set by the writer when it waits for room; the reader then bumps
+  /// `room_seq` (the futex word) and wakes it
+  alignas(64) std::atomic<uint32_t> writer_waiting;
+  std::atomic<uint32_t> room_seq;
+};
+
+/// Sleep while `*word` is `value` (at most `ms` milliseconds), and wake
+/// the sleepers on `word`; the ring is shared between processes, so these
+/// are not private futexes
+inline void waitOn(std::atomic<uint32_t>* word, uint32_t value, long ms) {
+#ifdef __linux__
+  struct timespec timeout = {ms / 1000, (ms % 1000) * 1000000};
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, value,
+          &timeout, nullptr, 0);
+#else
+  (void)word;
+  (void)value;
+  struct timespec nap = {0, std::min(ms, 1L) * 1000000};
+  nanosleep(&nap, nullptr);
+#endif
+}
+
+inline void wake(std::atomic<uint32_t>* word) {
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, 1,
+          nullptr, nullptr, 0);
+#else
+  (void)word;
+#endif
+}
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "futex words are plain 32-bit integers");
+
+#if ATOMIC_LLONG_LOCK_FREE != 2
+#error "shared memory ring needs lock-free (address-free) 64-bit atomics"
+#endif
+
+/// Mapping of a ring, either created (writer) or opened (reader)
+class Mapping {
+ protected:
+  Header* _hdr = nullptr;
+  char* _data = nullptr;
+  size_t _length = 0;
+  std::string _name;
+  /// capacity as checked when the ring was created or opened; the one
+  /// in the header can be overwritten by the other process
+  uint64_t _capacity = 0;
+
+  bool map(int fd, size_t length) {
+    void* p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) return false;
+    _hdr = static_cast<Header*>(p);
+    _data = static_cast<char*>(p) + sizeof(Header);
+    _length = length;
+    return true;
+  }
+
+ public:
+  Mapping() = default;
+  Mapping(const Mapping&) = delete;
+  Mapping& operator=(const Mapping&) = delete;
+  ~Mapping() {
+    if (_hdr) munmap(_hdr, _length);
+  }
+
+  bool isOpen() const { return _hdr != nullptr; }
+  const std::string& name() const { return _name; }
+  uint64_t capacity() const { return _capacity; }
+
+  /// number of published bytes not yet consumed
+  uint64_t size() const {
+    return _hdr->head.load(std::memory_order_acquire) -
+           _hdr->tail.load(std::memory_order_acquire);
+  }
+};
+
+class Writer : public Mapping {
+  bool _owner = false;
+
+ public:
+  ~Writer() {
+    if (_owner) shm_unlink(_name.c_str());
+  }
+
+  /// Create a new ring `name` (e.g. "/cpprofiler-1234") with room for
+  /// `capacity` bytes, rounded up to a power of two
+  bool create(const std::string& name, uint64_t capacity) {
+    uint64_t cap = 1;
+    while (cap < capacity) cap <<= 1;
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) return false;
+    const size_t length = sizeof(Header) + cap;
+    if (ftruncate(fd, length) != 0 || !map(fd, length)) {
+      close(fd);
+      shm_unlink(name.c_str());
+      return false;
+    }
+    close(fd);
+
+    _name = name;
+    _owner = true;
+    _hdr->magic = MAGIC;
+    _hdr->version = VERSION;
+    _hdr->capacity = cap;
+    _capacity = cap;
+    _hdr->head.store(0, std::memory_order_relaxed);
+    _hdr->tail.store(0, std::memory_order_relaxed);
+    _hdr->writer_waiting.store(0, std::memory_order_relaxed);
+    _hdr->room_seq.store(0, std::memory_order_relaxed);
+    _hdr->reader_waiting.store(0, std::memory_order_release);
+    return true;
+  }
+
+  /// Copy `n` bytes (from up to two pieces) into the ring, waiting for
+  /// the reader to make room if necessary; `n` must not exceed capacity.
+  /// Returns true if the reader asked for a doorbell.
+  bool write(const char* p1, uint64_t n1, const char* p2 = nullptr,
+             uint64_t n2 = 0) {
+    const uint64_t cap = _capacity;
+    const uint64_t n = n1 + n2;
+    const uint64_t head = _hdr->head.load(std::memory_order_relaxed);
+
+    waitForRoom(head, n);
+
+    uint64_t pos = head;
+    auto copy = [&](const char* src, uint64_t len) {
+      while (len > 0) {
+        const uint64_t off = pos & (cap - 1);
+        const uint64_t chunk = std::min(len, cap - off);
+        std::memcpy(_data + off, src, chunk);
+        src += chunk;
+        len -= chunk;
+        pos += chunk;
+      }
+    };
+    copy(p1, n1);
+    if (n2 > 0) copy(p2, n2);
+
+    _hdr->head.store(head + n, std::memory_order_seq_cst);
+
+    return _hdr->reader_waiting.load(std::memory_order_seq_cst) != 0 &&
+           _hdr->reader_waiting.exchange(0) != 0;
+  }
+ private:
+  /// a few yields before going to sleep, for a reader that is just busy
+  static constexpr int SPINS = 64;
+  /// longest sleep before looking at the ring again
+  static constexpr long SLEEP_MS = 100;
+
+  bool hasRoom(uint64_t head, uint64_t n) const {
+    return _capacity -
+               (head - _hdr->tail.load(std::memory_order_seq_cst)) >= n;
+  }
+
+  /// Block until the reader has made room for `n` bytes after `head`
+  void waitForRoom(uint64_t head, uint64_t n) {
+    for (int spin = 0; !hasRoom(head, n); ++spin) {
+      if (spin < SPINS) {
+        std::this_thread::yield();
+        continue;
+      }
+      /// room_seq is read before the flag is raised: a wake-up in between
+      /// changes it, and then the futex does not sleep
+      const uint32_t seq = _hdr->room_seq.load(std::memory_order_seq_cst);
+      _hdr->writer_waiting.store(1, std::memory_order_seq_cst);
+      if (!hasRoom(head, n)) waitOn(&_hdr->room_seq, seq, SLEEP_MS);
+      _hdr->writer_waiting.store(0, std::memory_order_relaxed);
+    }
+  }
+};
+
+class Reader : public Mapping {
+  bool _corrupt = false;
+
+ public:
+  /// Open the ring announced by a writer
+  bool open(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        static_cast<size_t>(st.st_size) < sizeof(Header) ||
+        !map(fd, st.st_size)) {
+      close(fd);
+      return false;
+    }
+    close(fd);
+
+    const uint64_t cap = _hdr->capacity;
+    if (_hdr->magic != MAGIC || _hdr->version != VERSION || cap == 0 ||
+        (cap & (cap - 1)) != 0 || sizeof(Header) + cap > _length) {
+      munmap(_hdr, _length);
+      _hdr = nullptr;
+      return false;
+    }
+    _name = name;
+    _capacity = cap;
+    return true;
+  }
+
+  /// Whether the writer published more bytes than the ring holds; read
+  /// returns nothing from then on and the connection should be closed
+  bool corrupt() const { return _corrupt; }
+
+  /// Move up to `max` published bytes into `dst`; returns how many
+  uint64_t read(char* dst, uint64_t max) {
+    if (_corrupt) return 0;
+    const uint64_t cap = _capacity;
+    const uint64_t tail = _hdr->tail.load(std::memory_order_relaxed);
+    const uint64_t head = _hdr->head.load(std::memory_order_acquire);
+    if (head - tail > cap) {
+      _corrupt = true;
+      return 0;
+    }
+    const uint64_t n = std::min(max, head - tail);
+
+    const uint64_t off = tail & (cap - 1);
+    const uint64_t first = std::min(n, cap - off);
+    std::memcpy(dst, _data + off, first);
+    std::memcpy(dst + first, _data, n - first);
+
+    _hdr->tail.store(tail + n, std::memory_order_seq_cst);
+
+    if (n > 0 && _hdr->writer_waiting.load(std::memory_order_seq_cst) != 0 &&
+        _hdr->writer_waiting.exchange(0) != 0) {
+      _hdr->room_seq.fetch_add(1, std::memory_order_seq_cst);
+      wake(&_hdr->room_seq);
+    }
+    return n;
+  }
+
+  /// Ask for a doorbell; returns false (and withdraws the request) if
+  /// data arrived in the meantime, in which case the caller reads again
+  bool prepareToSleep() {
+    _hdr->reader_waiting.store(1, std::memory_order_seq_cst);
+    if (_hdr->head.load(std::memory_order_seq_cst) ==
+        _hdr->tail.load(std::memory_order_relaxed))
+      return true;
+    _hdr->reader_waiting.store(0, std::memory_order_relaxed);
+    return false;
+  }
+};
+
+}  // namespace shm_ring
+
+#endif
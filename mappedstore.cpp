@@ -0,0 +1,147 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "mappedstore.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static size_t pageSize() {
+    static const size_t size = sysconf(_SC_PAGESIZE);
+    return size;
+}
+
+MappedStore::~MappedStore() {
+    for (auto& extent : _extents) munmap(extent.second.base, extent.second.length);
+    if (_fd != -1) close(_fd);
+}
+
+void MappedStore::configure(size_t budget, const std::string& dir) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _budget = budget;
+    _dir = dir;
+}
+
+bool MappedStore::grow(size_t bytes) {
+    if (_fd == -1) {
+        std::string path = _dir + "/cp-profiler-XXXXXX";
+        _fd = mkstemp(&path[0]);
+        if (_fd == -1) {
+            std::cerr << "can't create a file in " << _dir
+                      << ", keeping all nodes in memory\n";
+            return false;
+        }
+        /// the file goes away with the descriptor
+        unlink(path.c_str());
+    }
+
+    const size_t length = std::max(bytes, EXTENT_BYTES);
+
+    /// the new part of the file reads as zeros
+    void* p = MAP_FAILED;
+    if (ftruncate(_fd, _file_bytes + length) == 0) {
+        p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, _fd,
+                 _file_bytes);
+    }
+    if (p == MAP_FAILED) {
+        std::cerr << "can't map " << length << " more bytes of " << _dir
+                  << " (" << std::strerror(errno)
+                  << "), keeping the rest of the nodes in memory\n";
+        return false;
+    }
+
+    Extent extent{static_cast<char*>(p), length, static_cast<off_t>(_file_bytes), 0};
+    _current = &_extents.emplace(extent.base, extent).first->second;
+    _file_bytes += length;
+    return true;
+}
+
+char* MappedStore::map(size_t bytes) {
+    const size_t page = pageSize();
+    const size_t length = (bytes + page - 1) / page * page;
+
+    /// what is left of the last extent is never touched, so it takes no
+    /// memory (and no disk, the file being sparse)
+    if (!_current || _current->length - _current->used < length) {
+        if (!grow(length)) {
+            _no_file = true;
+            return nullptr;
+        }
+    }
+
+    char* p = _current->base + _current->used;
+    _current->used += length;
+    _mapped_bytes += length;
+    return p;
+}
+
+char* MappedStore::allocate(size_t bytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_budget > 0 && !_no_file && _heap_bytes + bytes > _budget) {
+        if (char* p = map(bytes)) return p;
+    }
+
+    _heap.emplace_back(new char[bytes]);
+    _heap_bytes += bytes;
+    return _heap.back().get();
+}
+
+void MappedStore::seal(const char* p, size_t bytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    /// the extent starting at or before p
+    auto it = _extents.upper_bound(p);
+    if (it == _extents.begin()) return;
+    const Extent& extent = (--it)->second;
+    if (p >= extent.base + extent.length) return;
+
+    /// only whole pages: the rest of the last one may still change
+    const size_t at = p - extent.base;
+    const size_t length =
+        std::min(bytes, extent.length - at) / pageSize() * pageSize();
+    if (length == 0) return;
+#ifdef MADV_COLD
+    /// first to go when memory is short
+    madvise(extent.base + at, length, MADV_COLD);
+#endif
+#ifdef SYNC_FILE_RANGE_WRITE
+    /// start writing it out (msync(MS_ASYNC) does not, on Linux)
+    sync_file_range(_fd, extent.offset + at, length, SYNC_FILE_RANGE_WRITE);
+#endif
+}
+
+size_t MappedStore::heapBytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _heap_bytes;
+}
+
+size_t MappedStore::mappedBytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _mapped_bytes;
+}
@@ -0,0 +1,107 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef MAPPED_STORE_HH
+#define MAPPED_STORE_HH
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+/// Where the big, append-only parts of an execution live: the node
+/// columns and the nogood / info blocks.
+///
+/// Blocks come from the heap while the execution holds less than its
+/// budget; past it they are mapped from a file (unlinked as soon as it
+/// is created), so the kernel writes them out and reads them back as
+/// they are used instead of keeping them all in memory.  The file grows
+/// by extents of at least EXTENT_BYTES, each mapped once, and blocks are
+/// carved from the last one, so the number of mappings stays far below
+/// vm.max_map_count.  Blocks are freed when the store is destroyed.
+class MappedStore {
+public:
+    /// smallest piece of the file mapped at once
+    static constexpr size_t EXTENT_BYTES = size_t(64) << 20;
+
+    MappedStore() = default;
+    ~MappedStore();
+
+    MappedStore(const MappedStore&) = delete;
+    MappedStore& operator=(const MappedStore&) = delete;
+
+    /// Bytes to keep on the heap, 0 for no limit (nothing is mapped);
+    /// files are created in `dir`
+    void configure(size_t budget, const std::string& dir);
+
+    /// A block of `bytes`, not initialised (so no page of it is touched
+    /// before it is written); can be called from any thread
+    char* allocate(size_t bytes);
+
+    /// The first `bytes` of the block at `p` (from allocate) are not going
+    /// to change: their whole pages are marked cold and, on Linux, queued
+    /// for writeback, so they are clean and cheap to drop
+    void seal(const char* p, size_t bytes);
+
+    /// Bytes allocated on the heap / mapped from the file
+    size_t heapBytes() const;
+    size_t mappedBytes() const;
+
+private:
+    mutable std::mutex _mutex;
+
+    size_t _budget = 0;
+    std::string _dir;
+
+    std::vector<std::unique_ptr<char[]>> _heap;
+    size_t _heap_bytes = 0;
+
+    /// the file, -1 until the budget is reached
+    int _fd = -1;
+    /// whether creating or mapping the file failed (everything goes to
+    /// the heap from then on)
+    bool _no_file = false;
+    size_t _file_bytes = 0;
+
+    /// a mapped piece of the file; blocks are carved from its front
+    struct Extent {
+        char* base;
+        size_t length;
+        off_t offset;  /// in the file
+        size_t used;
+    };
+    /// by address, for seal to find the extent of a block
+    std::map<const char*, Extent> _extents;
+    Extent* _current = nullptr;
+    /// bytes of blocks handed out from the extents
+    size_t _mapped_bytes = 0;
+
+    /// a page-aligned block of `bytes` from the file, null if it can't be had
+    char* map(size_t bytes);
+    /// map a new extent of at least `bytes`
+    bool grow(size_t bytes);
+};
+
+#endif
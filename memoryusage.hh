@@ -0,0 +1,58 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef MEMORY_USAGE_HH
+#define MEMORY_USAGE_HH
+
+#include <cstddef>
+
+/// Bytes held by one execution, by what they are used for (see
+/// Execution::memoryUsage)
+struct MemoryUsage {
+    /// node columns
+    size_t entries = 0;
+    /// the label table; shared by all executions
+    size_t labels = 0;
+    size_t nogoods = 0;
+    size_t info = 0;
+    /// sid -> entry and gid -> entry
+    size_t indexes = 0;
+    /// of entries, nogoods and info: how much is mapped from a file
+    /// (see --memory_budget)
+    size_t mapped = 0;
+
+    /// visual nodes and the array of them
+    size_t nodes = 0;
+    /// child arrays of nodes with more than two children
+    size_t children = 0;
+    /// shape extents (from the global heap)
+    size_t shapes = 0;
+    /// buffers of pixel trees and other views
+    size_t views = 0;
+
+    /// everything but the labels, which are not this execution's alone
+    size_t total() const {
+        return entries + nogoods + info + indexes + nodes + children + shapes +
+               views;
+    }
+};
+
+#endif
@@ -1,164 +1,309 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: message.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "message.pb.hh"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace message {
-
-namespace {
-
-const ::google::protobuf::Descriptor* Node_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Node_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Node_MsgType_descriptor_ = NULL;
-const ::google::protobuf::EnumDescriptor* Node_NodeStatus_descriptor_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_message_2eproto() {
-  protobuf_AddDesc_message_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "message.proto");
-  GOOGLE_CHECK(file != NULL);
-  Node_descriptor_ = file->message_type(0);
-  static const int Node_offsets_[18] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, sid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, pid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, alt_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, kids_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, status_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, restart_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, time_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, thread_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, label_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, domain_size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, solution_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, nogood_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, info_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, nogood_bld_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, uses_assumptions_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, backjump_distance_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, decision_level_),
-  };
-  Node_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Node_descriptor_,
-      Node::default_instance_,
-      Node_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Node));
-  Node_MsgType_descriptor_ = Node_descriptor_->enum_type(0);
-  Node_NodeStatus_descriptor_ = Node_descriptor_->enum_type(1);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_message_2eproto);
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Node_descriptor_, &Node::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_message_2eproto() {
-  delete Node::default_instance_;
-  delete Node_reflection_;
-}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-void protobuf_AddDesc_message_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\rmessage.proto\022\007message\"\222\004\n\004Node\022#\n\004typ"
-    "e\030\001 \002(\0162\025.message.Node.MsgType\022\013\n\003sid\030\002 "
-    "\001(\005\022\013\n\003pid\030\003 \001(\005\022\013\n\003alt\030\004 \001(\005\022\014\n\004kids\030\005 "
-    "\001(\005\022(\n\006status\030\006 \001(\0162\030.message.Node.NodeS"
-    "tatus\022\022\n\nrestart_id\030\007 \001(\005\022\014\n\004time\030\010 \001(\004\022"
-    "\021\n\tthread_id\030\t \001(\005\022\r\n\005label\030\n \001(\t\022\023\n\013dom"
-    "ain_size\030\013 \001(\002\022\020\n\010solution\030\014 \001(\t\022\016\n\006nogo"
-    "od\030\r \001(\t\022\014\n\004info\030\016 \001(\t\022\022\n\nnogood_bld\030\017 \001"
-    "(\005\022\030\n\020uses_assumptions\030\020 \001(\010\022\031\n\021backjump"
-    "_distance\030\021 \001(\005\022\026\n\016decision_level\030\022 \001(\005\""
-    "(\n\007MsgType\022\010\n\004NODE\020\000\022\010\n\004DONE\020\001\022\t\n\005START\020"
-    "\002\"r\n\nNodeStatus\022\n\n\006SOLVED\020\000\022\n\n\006FAILED\020\001\022"
-    "\n\n\006BRANCH\020\002\022\020\n\014UNDETERMINED\020\003\022\010\n\004STOP\020\004\022"
-    "\n\n\006UNSTOP\020\005\022\013\n\007SKIPPED\020\006\022\013\n\007MERGING\020\007B\027\n"
-    "\025com.github.cpprofiler", 582);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "message.proto", &protobuf_RegisterTypes);
-  Node::default_instance_ = new Node();
-  Node::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_message_2eproto);
+namespace message {
+PROTOBUF_CONSTEXPR Node::Node(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.labels_)*/{}
+  , /*decltype(_impl_.label_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.solution_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.nogood_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.info_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.batch_)*/nullptr
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.sid_)*/0
+  , /*decltype(_impl_.pid_)*/0
+  , /*decltype(_impl_.alt_)*/0
+  , /*decltype(_impl_.kids_)*/0
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.time_)*/uint64_t{0u}
+  , /*decltype(_impl_.restart_id_)*/0
+  , /*decltype(_impl_.thread_id_)*/0
+  , /*decltype(_impl_.domain_size_)*/0
+  , /*decltype(_impl_.nogood_bld_)*/0
+  , /*decltype(_impl_.backjump_distance_)*/0
+  , /*decltype(_impl_.decision_level_)*/0
+  , /*decltype(_impl_.credit_)*/int64_t{0}
+  , /*decltype(_impl_.uses_assumptions_)*/false
+  , /*decltype(_impl_.flow_control_)*/false
+  , /*decltype(_impl_.first_label_id_)*/0
+  , /*decltype(_impl_.label_id_)*/0
+  , /*decltype(_impl_.encoding_)*/0} {}
+struct NodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeDefaultTypeInternal() {}
+  union {
+    Node _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeDefaultTypeInternal _Node_default_instance_;
+PROTOBUF_CONSTEXPR NodeBatch::NodeBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sid_)*/{}
+  , /*decltype(_impl_._sid_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.pid_)*/{}
+  , /*decltype(_impl_._pid_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.alt_)*/{}
+  , /*decltype(_impl_._alt_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.kids_)*/{}
+  , /*decltype(_impl_._kids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.status_)*/{}
+  , /*decltype(_impl_._status_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.restart_id_)*/{}
+  , /*decltype(_impl_._restart_id_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.time_)*/{}
+  , /*decltype(_impl_._time_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.thread_id_)*/{}
+  , /*decltype(_impl_._thread_id_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.label_)*/{}
+  , /*decltype(_impl_._label_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.label_table_)*/{}
+  , /*decltype(_impl_.domain_size_)*/{}
+  , /*decltype(_impl_.decision_level_)*/{}
+  , /*decltype(_impl_._decision_level_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nogood_idx_)*/{}
+  , /*decltype(_impl_._nogood_idx_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nogood_)*/{}
+  , /*decltype(_impl_.info_idx_)*/{}
+  , /*decltype(_impl_._info_idx_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.info_)*/{}
+  , /*decltype(_impl_.label_id_)*/{}
+  , /*decltype(_impl_._label_id_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.sid_delta_)*/{}
+  , /*decltype(_impl_._sid_delta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.pid_delta_)*/{}
+  , /*decltype(_impl_._pid_delta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.time_delta_)*/{}
+  , /*decltype(_impl_._time_delta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nogood_bld_)*/{}
+  , /*decltype(_impl_._nogood_bld_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.uses_assumptions_)*/{}
+  , /*decltype(_impl_.backjump_distance_)*/{}
+  , /*decltype(_impl_._backjump_distance_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NodeBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeBatchDefaultTypeInternal() {}
+  union {
+    NodeBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeBatchDefaultTypeInternal _NodeBatch_default_instance_;
+}  // namespace message
+static ::_pb::Metadata file_level_metadata_message_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_message_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_message_2eproto = nullptr;
+
+const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.sid_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.pid_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.alt_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.kids_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.restart_id_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.time_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.thread_id_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.label_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.domain_size_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.solution_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.nogood_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.info_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.nogood_bld_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.uses_assumptions_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.backjump_distance_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.decision_level_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.batch_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.credit_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.flow_control_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.labels_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.first_label_id_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.label_id_),
+  PROTOBUF_FIELD_OFFSET(::message::Node, _impl_.encoding_),
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  12,
+  11,
+  13,
+  0,
+  14,
+  1,
+  2,
+  3,
+  15,
+  19,
+  16,
+  17,
+  4,
+  18,
+  20,
+  ~0u,
+  21,
+  22,
+  23,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.sid_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.pid_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.alt_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.kids_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.restart_id_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.time_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.thread_id_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.label_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.label_table_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.domain_size_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.decision_level_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.nogood_idx_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.nogood_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.info_idx_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.info_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.label_id_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.sid_delta_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.pid_delta_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.time_delta_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.nogood_bld_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.uses_assumptions_),
+  PROTOBUF_FIELD_OFFSET(::message::NodeBatch, _impl_.backjump_distance_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 31, -1, sizeof(::message::Node)},
+  { 56, -1, -1, sizeof(::message::NodeBatch)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::message::_Node_default_instance_._instance,
+  &::message::_NodeBatch_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_message_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rmessage.proto\022\007message\"\235\006\n\004Node\022#\n\004typ"
+  "e\030\001 \002(\0162\025.message.Node.MsgType\022\013\n\003sid\030\002 "
+  "\001(\005\022\013\n\003pid\030\003 \001(\005\022\013\n\003alt\030\004 \001(\005\022\014\n\004kids\030\005 "
+  "\001(\005\022(\n\006status\030\006 \001(\0162\030.message.Node.NodeS"
+  "tatus\022\022\n\nrestart_id\030\007 \001(\005\022\014\n\004time\030\010 \001(\004\022"
+  "\021\n\tthread_id\030\t \001(\005\022\r\n\005label\030\n \001(\t\022\023\n\013dom"
+  "ain_size\030\013 \001(\002\022\020\n\010solution\030\014 \001(\t\022\016\n\006nogo"
+  "od\030\r \001(\t\022\014\n\004info\030\016 \001(\t\022\022\n\nnogood_bld\030\017 \001"
+  "(\005\022\030\n\020uses_assumptions\030\020 \001(\010\022\031\n\021backjump"
+  "_distance\030\021 \001(\005\022\026\n\016decision_level\030\022 \001(\005\022"
+  "!\n\005batch\030\023 \001(\0132\022.message.NodeBatch\022\016\n\006cr"
+  "edit\030\024 \001(\003\022\024\n\014flow_control\030\025 \001(\010\022\016\n\006labe"
+  "ls\030\026 \003(\t\022\026\n\016first_label_id\030\027 \001(\005\022\020\n\010labe"
+  "l_id\030\030 \001(\005\022(\n\010encoding\030\031 \001(\0162\026.message.N"
+  "ode.Encoding\"d\n\007MsgType\022\010\n\004NODE\020\000\022\010\n\004DON"
+  "E\020\001\022\t\n\005START\020\002\022\016\n\nNODE_BATCH\020\003\022\016\n\nATTACH"
+  "_SHM\020\004\022\n\n\006CREDIT\020\005\022\016\n\nLABEL_DICT\020\006\"r\n\nNo"
+  "deStatus\022\n\n\006SOLVED\020\000\022\n\n\006FAILED\020\001\022\n\n\006BRAN"
+  "CH\020\002\022\020\n\014UNDETERMINED\020\003\022\010\n\004STOP\020\004\022\n\n\006UNST"
+  "OP\020\005\022\013\n\007SKIPPED\020\006\022\013\n\007MERGING\020\007\" \n\010Encodi"
+  "ng\022\t\n\005PLAIN\020\000\022\t\n\005DELTA\020\001\"\377\003\n\tNodeBatch\022\017"
+  "\n\003sid\030\001 \003(\005B\002\020\001\022\017\n\003pid\030\002 \003(\005B\002\020\001\022\017\n\003alt\030"
+  "\003 \003(\005B\002\020\001\022\020\n\004kids\030\004 \003(\005B\002\020\001\022\022\n\006status\030\005 "
+  "\003(\005B\002\020\001\022\026\n\nrestart_id\030\006 \003(\005B\002\020\001\022\020\n\004time\030"
+  "\007 \003(\004B\002\020\001\022\025\n\tthread_id\030\010 \003(\005B\002\020\001\022\021\n\005labe"
+  "l\030\t \003(\005B\002\020\001\022\023\n\013label_table\030\n \003(\t\022\027\n\013doma"
+  "in_size\030\013 \003(\002B\002\020\001\022\032\n\016decision_level\030\014 \003("
+  "\005B\002\020\001\022\026\n\nnogood_idx\030\r \003(\005B\002\020\001\022\016\n\006nogood\030"
+  "\016 \003(\t\022\024\n\010info_idx\030\017 \003(\005B\002\020\001\022\014\n\004info\030\020 \003("
+  "\t\022\024\n\010label_id\030\021 \003(\005B\002\020\001\022\025\n\tsid_delta\030\022 \003"
+  "(\021B\002\020\001\022\025\n\tpid_delta\030\023 \003(\021B\002\020\001\022\026\n\ntime_de"
+  "lta\030\024 \003(\022B\002\020\001\022\026\n\nnogood_bld\030\025 \003(\005B\002\020\001\022\034\n"
+  "\020uses_assumptions\030\026 \003(\010B\002\020\001\022\035\n\021backjump_"
+  "distance\030\027 \003(\005B\002\020\001B\027\n\025com.github.cpprofi"
+  "ler"
+  ;
+static ::_pbi::once_flag descriptor_table_message_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_message_2eproto = {
+    false, false, 1363, descriptor_table_protodef_message_2eproto,
+    "message.proto",
+    &descriptor_table_message_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_message_2eproto::offsets,
+    file_level_metadata_message_2eproto, file_level_enum_descriptors_message_2eproto,
+    file_level_service_descriptors_message_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_message_2eproto_getter() {
+  return &descriptor_table_message_2eproto;
 }
 
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_message_2eproto {
-  StaticDescriptorInitializer_message_2eproto() {
-    protobuf_AddDesc_message_2eproto();
-  }
-} static_descriptor_initializer_message_2eproto_;
-
-// ===================================================================
-
-const ::google::protobuf::EnumDescriptor* Node_MsgType_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Node_MsgType_descriptor_;
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_message_2eproto(&descriptor_table_message_2eproto);
+namespace message {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Node_MsgType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_message_2eproto);
+  return file_level_enum_descriptors_message_2eproto[0];
 }
 bool Node_MsgType_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
     case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
       return true;
     default:
       return false;
   }
 }
 
-#ifndef _MSC_VER
-const Node_MsgType Node::NODE;
-const Node_MsgType Node::DONE;
-const Node_MsgType Node::START;
-const Node_MsgType Node::MsgType_MIN;
-const Node_MsgType Node::MsgType_MAX;
-const int Node::MsgType_ARRAYSIZE;
-#endif  // _MSC_VER
-const ::google::protobuf::EnumDescriptor* Node_NodeStatus_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Node_NodeStatus_descriptor_;
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Node_MsgType Node::NODE;
+constexpr Node_MsgType Node::DONE;
+constexpr Node_MsgType Node::START;
+constexpr Node_MsgType Node::NODE_BATCH;
+constexpr Node_MsgType Node::ATTACH_SHM;
+constexpr Node_MsgType Node::CREDIT;
+constexpr Node_MsgType Node::LABEL_DICT;
+constexpr Node_MsgType Node::MsgType_MIN;
+constexpr Node_MsgType Node::MsgType_MAX;
+constexpr int Node::MsgType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Node_NodeStatus_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_message_2eproto);
+  return file_level_enum_descriptors_message_2eproto[1];
 }
 bool Node_NodeStatus_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
     case 2:
@@ -173,1011 +318,2232 @@ bool Node_NodeStatus_IsValid(int value) {
   }
 }
 
-#ifndef _MSC_VER
-const Node_NodeStatus Node::SOLVED;
-const Node_NodeStatus Node::FAILED;
-const Node_NodeStatus Node::BRANCH;
-const Node_NodeStatus Node::UNDETERMINED;
-const Node_NodeStatus Node::STOP;
-const Node_NodeStatus Node::UNSTOP;
-const Node_NodeStatus Node::SKIPPED;
-const Node_NodeStatus Node::MERGING;
-const Node_NodeStatus Node::NodeStatus_MIN;
-const Node_NodeStatus Node::NodeStatus_MAX;
-const int Node::NodeStatus_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Node::kTypeFieldNumber;
-const int Node::kSidFieldNumber;
-const int Node::kPidFieldNumber;
-const int Node::kAltFieldNumber;
-const int Node::kKidsFieldNumber;
-const int Node::kStatusFieldNumber;
-const int Node::kRestartIdFieldNumber;
-const int Node::kTimeFieldNumber;
-const int Node::kThreadIdFieldNumber;
-const int Node::kLabelFieldNumber;
-const int Node::kDomainSizeFieldNumber;
-const int Node::kSolutionFieldNumber;
-const int Node::kNogoodFieldNumber;
-const int Node::kInfoFieldNumber;
-const int Node::kNogoodBldFieldNumber;
-const int Node::kUsesAssumptionsFieldNumber;
-const int Node::kBackjumpDistanceFieldNumber;
-const int Node::kDecisionLevelFieldNumber;
-#endif  // !_MSC_VER
-
-Node::Node()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:message.Node)
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Node_NodeStatus Node::SOLVED;
+constexpr Node_NodeStatus Node::FAILED;
+constexpr Node_NodeStatus Node::BRANCH;
+constexpr Node_NodeStatus Node::UNDETERMINED;
+constexpr Node_NodeStatus Node::STOP;
+constexpr Node_NodeStatus Node::UNSTOP;
+constexpr Node_NodeStatus Node::SKIPPED;
+constexpr Node_NodeStatus Node::MERGING;
+constexpr Node_NodeStatus Node::NodeStatus_MIN;
+constexpr Node_NodeStatus Node::NodeStatus_MAX;
+constexpr int Node::NodeStatus_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Node_Encoding_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_message_2eproto);
+  return file_level_enum_descriptors_message_2eproto[2];
 }
-
-void Node::InitAsDefaultInstance() {
+bool Node_Encoding_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Node::Node(const Node& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:message.Node)
-}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Node_Encoding Node::PLAIN;
+constexpr Node_Encoding Node::DELTA;
+constexpr Node_Encoding Node::Encoding_MIN;
+constexpr Node_Encoding Node::Encoding_MAX;
+constexpr int Node::Encoding_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
-void Node::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  type_ = 0;
-  sid_ = 0;
-  pid_ = 0;
-  alt_ = 0;
-  kids_ = 0;
-  status_ = 0;
-  restart_id_ = 0;
-  time_ = GOOGLE_ULONGLONG(0);
-  thread_id_ = 0;
-  label_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  domain_size_ = 0;
-  solution_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  nogood_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  info_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  nogood_bld_ = 0;
-  uses_assumptions_ = false;
-  backjump_distance_ = 0;
-  decision_level_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+// ===================================================================
 
-Node::~Node() {
-  // @@protoc_insertion_point(destructor:message.Node)
-  SharedDtor();
-}
+class Node::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Node>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_sid(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_pid(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_alt(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_kids(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_restart_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_thread_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_label(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_domain_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_solution(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_nogood(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_info(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_nogood_bld(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_uses_assumptions(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_backjump_distance(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_decision_level(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static const ::message::NodeBatch& batch(const Node* msg);
+  static void set_has_batch(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_credit(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_flow_control(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static void set_has_first_label_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+  static void set_has_label_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4194304u;
+  }
+  static void set_has_encoding(HasBits* has_bits) {
+    (*has_bits)[0] |= 8388608u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000020) ^ 0x00000020) != 0;
+  }
+};
 
-void Node::SharedDtor() {
-  if (label_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete label_;
+const ::message::NodeBatch&
+Node::_Internal::batch(const Node* msg) {
+  return *msg->_impl_.batch_;
+}
+Node::Node(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:message.Node)
+}
+Node::Node(const Node& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Node* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.labels_){from._impl_.labels_}
+    , decltype(_impl_.label_){}
+    , decltype(_impl_.solution_){}
+    , decltype(_impl_.nogood_){}
+    , decltype(_impl_.info_){}
+    , decltype(_impl_.batch_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.sid_){}
+    , decltype(_impl_.pid_){}
+    , decltype(_impl_.alt_){}
+    , decltype(_impl_.kids_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.time_){}
+    , decltype(_impl_.restart_id_){}
+    , decltype(_impl_.thread_id_){}
+    , decltype(_impl_.domain_size_){}
+    , decltype(_impl_.nogood_bld_){}
+    , decltype(_impl_.backjump_distance_){}
+    , decltype(_impl_.decision_level_){}
+    , decltype(_impl_.credit_){}
+    , decltype(_impl_.uses_assumptions_){}
+    , decltype(_impl_.flow_control_){}
+    , decltype(_impl_.first_label_id_){}
+    , decltype(_impl_.label_id_){}
+    , decltype(_impl_.encoding_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_label()) {
+    _this->_impl_.label_.Set(from._internal_label(), 
+      _this->GetArenaForAllocation());
   }
-  if (solution_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete solution_;
+  _impl_.solution_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.solution_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_solution()) {
+    _this->_impl_.solution_.Set(from._internal_solution(), 
+      _this->GetArenaForAllocation());
   }
-  if (nogood_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete nogood_;
+  _impl_.nogood_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nogood_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_nogood()) {
+    _this->_impl_.nogood_.Set(from._internal_nogood(), 
+      _this->GetArenaForAllocation());
   }
-  if (info_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete info_;
+  _impl_.info_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.info_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_info()) {
+    _this->_impl_.info_.Set(from._internal_info(), 
+      _this->GetArenaForAllocation());
   }
-  if (this != default_instance_) {
+  if (from._internal_has_batch()) {
+    _this->_impl_.batch_ = new ::message::NodeBatch(*from._impl_.batch_);
   }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.encoding_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.encoding_));
+  // @@protoc_insertion_point(copy_constructor:message.Node)
 }
 
-void Node::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Node::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Node_descriptor_;
+inline void Node::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.labels_){arena}
+    , decltype(_impl_.label_){}
+    , decltype(_impl_.solution_){}
+    , decltype(_impl_.nogood_){}
+    , decltype(_impl_.info_){}
+    , decltype(_impl_.batch_){nullptr}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.sid_){0}
+    , decltype(_impl_.pid_){0}
+    , decltype(_impl_.alt_){0}
+    , decltype(_impl_.kids_){0}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.time_){uint64_t{0u}}
+    , decltype(_impl_.restart_id_){0}
+    , decltype(_impl_.thread_id_){0}
+    , decltype(_impl_.domain_size_){0}
+    , decltype(_impl_.nogood_bld_){0}
+    , decltype(_impl_.backjump_distance_){0}
+    , decltype(_impl_.decision_level_){0}
+    , decltype(_impl_.credit_){int64_t{0}}
+    , decltype(_impl_.uses_assumptions_){false}
+    , decltype(_impl_.flow_control_){false}
+    , decltype(_impl_.first_label_id_){0}
+    , decltype(_impl_.label_id_){0}
+    , decltype(_impl_.encoding_){0}
+  };
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.solution_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.solution_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.nogood_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nogood_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.info_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.info_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-const Node& Node::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_message_2eproto();
-  return *default_instance_;
+Node::~Node() {
+  // @@protoc_insertion_point(destructor:message.Node)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-Node* Node::default_instance_ = NULL;
+inline void Node::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.labels_.~RepeatedPtrField();
+  _impl_.label_.Destroy();
+  _impl_.solution_.Destroy();
+  _impl_.nogood_.Destroy();
+  _impl_.info_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.batch_;
+}
 
-Node* Node::New() const {
-  return new Node;
+void Node::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void Node::Clear() {
-#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
-  &reinterpret_cast<Node*>(16)->f) - \
-   reinterpret_cast<char*>(16))
-
-#define ZR_(first, last) do {                              \
-    size_t f = OFFSET_OF_FIELD_(first);                    \
-    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
-    ::memset(&first, 0, n);                                \
-  } while (0)
-
-  if (_has_bits_[0 / 32] & 255) {
-    ZR_(type_, restart_id_);
-  }
-  if (_has_bits_[8 / 32] & 65280) {
-    ZR_(domain_size_, nogood_bld_);
-    thread_id_ = 0;
-    if (has_label()) {
-      if (label_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        label_->clear();
-      }
-    }
-    if (has_solution()) {
-      if (solution_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        solution_->clear();
-      }
-    }
-    if (has_nogood()) {
-      if (nogood_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        nogood_->clear();
-      }
-    }
-    if (has_info()) {
-      if (info_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        info_->clear();
-      }
-    }
-    uses_assumptions_ = false;
-  }
-  ZR_(backjump_distance_, decision_level_);
-
-#undef OFFSET_OF_FIELD_
-#undef ZR_
-
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+// @@protoc_insertion_point(message_clear_start:message.Node)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.labels_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.label_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.solution_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.nogood_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.info_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.batch_ != nullptr);
+      _impl_.batch_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000e0u) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.pid_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.pid_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.alt_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.nogood_bld_) -
+        reinterpret_cast<char*>(&_impl_.alt_)) + sizeof(_impl_.nogood_bld_));
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    ::memset(&_impl_.backjump_distance_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.encoding_) -
+        reinterpret_cast<char*>(&_impl_.backjump_distance_)) + sizeof(_impl_.encoding_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Node::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:message.Node)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(16383);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Node::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .message.Node.MsgType type = 1;
-      case 1: {
-        if (tag == 8) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::message::Node_MsgType_IsValid(value)) {
-            set_type(static_cast< ::message::Node_MsgType >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::message::Node_MsgType_IsValid(val))) {
+            _internal_set_type(static_cast<::message::Node_MsgType>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_sid;
-        break;
-      }
-
+        continue;
       // optional int32 sid = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_sid:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &sid_)));
-          set_has_sid();
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_sid(&has_bits);
+          _impl_.sid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_pid;
-        break;
-      }
-
+        continue;
       // optional int32 pid = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_pid:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &pid_)));
-          set_has_pid();
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_pid(&has_bits);
+          _impl_.pid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(32)) goto parse_alt;
-        break;
-      }
-
+        continue;
       // optional int32 alt = 4;
-      case 4: {
-        if (tag == 32) {
-         parse_alt:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &alt_)));
-          set_has_alt();
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_alt(&has_bits);
+          _impl_.alt_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(40)) goto parse_kids;
-        break;
-      }
-
+        continue;
       // optional int32 kids = 5;
-      case 5: {
-        if (tag == 40) {
-         parse_kids:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &kids_)));
-          set_has_kids();
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_kids(&has_bits);
+          _impl_.kids_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(48)) goto parse_status;
-        break;
-      }
-
+        continue;
       // optional .message.Node.NodeStatus status = 6;
-      case 6: {
-        if (tag == 48) {
-         parse_status:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::message::Node_NodeStatus_IsValid(value)) {
-            set_status(static_cast< ::message::Node_NodeStatus >(value));
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::message::Node_NodeStatus_IsValid(val))) {
+            _internal_set_status(static_cast<::message::Node_NodeStatus>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(6, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
           }
-        } else {
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(56)) goto parse_restart_id;
-        break;
-      }
-
+        continue;
       // optional int32 restart_id = 7;
-      case 7: {
-        if (tag == 56) {
-         parse_restart_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &restart_id_)));
-          set_has_restart_id();
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_restart_id(&has_bits);
+          _impl_.restart_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(64)) goto parse_time;
-        break;
-      }
-
+        continue;
       // optional uint64 time = 8;
-      case 8: {
-        if (tag == 64) {
-         parse_time:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &time_)));
-          set_has_time();
-        } else {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_time(&has_bits);
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(72)) goto parse_thread_id;
-        break;
-      }
-
+        continue;
       // optional int32 thread_id = 9;
-      case 9: {
-        if (tag == 72) {
-         parse_thread_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &thread_id_)));
-          set_has_thread_id();
-        } else {
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_thread_id(&has_bits);
+          _impl_.thread_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(82)) goto parse_label;
-        break;
-      }
-
+        continue;
       // optional string label = 10;
-      case 10: {
-        if (tag == 82) {
-         parse_label:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_label()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->label().data(), this->label().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "label");
-        } else {
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_label();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "message.Node.label");
+          #endif  // !NDEBUG
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(93)) goto parse_domain_size;
-        break;
-      }
-
+        continue;
       // optional float domain_size = 11;
-      case 11: {
-        if (tag == 93) {
-         parse_domain_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &domain_size_)));
-          set_has_domain_size();
-        } else {
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 93)) {
+          _Internal::set_has_domain_size(&has_bits);
+          _impl_.domain_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(98)) goto parse_solution;
-        break;
-      }
-
+        continue;
       // optional string solution = 12;
-      case 12: {
-        if (tag == 98) {
-         parse_solution:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_solution()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->solution().data(), this->solution().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "solution");
-        } else {
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          auto str = _internal_mutable_solution();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "message.Node.solution");
+          #endif  // !NDEBUG
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(106)) goto parse_nogood;
-        break;
-      }
-
+        continue;
       // optional string nogood = 13;
-      case 13: {
-        if (tag == 106) {
-         parse_nogood:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_nogood()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->nogood().data(), this->nogood().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "nogood");
-        } else {
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          auto str = _internal_mutable_nogood();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "message.Node.nogood");
+          #endif  // !NDEBUG
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(114)) goto parse_info;
-        break;
-      }
-
+        continue;
       // optional string info = 14;
-      case 14: {
-        if (tag == 114) {
-         parse_info:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_info()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->info().data(), this->info().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "info");
-        } else {
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_info();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "message.Node.info");
+          #endif  // !NDEBUG
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(120)) goto parse_nogood_bld;
-        break;
-      }
-
+        continue;
       // optional int32 nogood_bld = 15;
-      case 15: {
-        if (tag == 120) {
-         parse_nogood_bld:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &nogood_bld_)));
-          set_has_nogood_bld();
-        } else {
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_nogood_bld(&has_bits);
+          _impl_.nogood_bld_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(128)) goto parse_uses_assumptions;
-        break;
-      }
-
+        continue;
       // optional bool uses_assumptions = 16;
-      case 16: {
-        if (tag == 128) {
-         parse_uses_assumptions:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &uses_assumptions_)));
-          set_has_uses_assumptions();
-        } else {
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_uses_assumptions(&has_bits);
+          _impl_.uses_assumptions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(136)) goto parse_backjump_distance;
-        break;
-      }
-
+        continue;
       // optional int32 backjump_distance = 17;
-      case 17: {
-        if (tag == 136) {
-         parse_backjump_distance:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &backjump_distance_)));
-          set_has_backjump_distance();
-        } else {
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _Internal::set_has_backjump_distance(&has_bits);
+          _impl_.backjump_distance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(144)) goto parse_decision_level;
-        break;
-      }
-
+        continue;
       // optional int32 decision_level = 18;
-      case 18: {
-        if (tag == 144) {
-         parse_decision_level:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &decision_level_)));
-          set_has_decision_level();
-        } else {
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _Internal::set_has_decision_level(&has_bits);
+          _impl_.decision_level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:message.Node)
-  return true;
+        continue;
+      // optional .message.NodeBatch batch = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 credit = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _Internal::set_has_credit(&has_bits);
+          _impl_.credit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool flow_control = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          _Internal::set_has_flow_control(&has_bits);
+          _impl_.flow_control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string labels = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_labels();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "message.Node.labels");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<178>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 first_label_id = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 184)) {
+          _Internal::set_has_first_label_id(&has_bits);
+          _impl_.first_label_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 label_id = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 192)) {
+          _Internal::set_has_label_id(&has_bits);
+          _impl_.label_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .message.Node.Encoding encoding = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 200)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::message::Node_Encoding_IsValid(val))) {
+            _internal_set_encoding(static_cast<::message::Node_Encoding>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(25, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:message.Node)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Node::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:message.Node)
+uint8_t* Node::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:message.Node)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .message.Node.MsgType type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // optional int32 sid = 2;
-  if (has_sid()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->sid(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_sid(), target);
   }
 
   // optional int32 pid = 3;
-  if (has_pid()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->pid(), output);
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_pid(), target);
   }
 
   // optional int32 alt = 4;
-  if (has_alt()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->alt(), output);
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_alt(), target);
   }
 
   // optional int32 kids = 5;
-  if (has_kids()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->kids(), output);
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_kids(), target);
   }
 
   // optional .message.Node.NodeStatus status = 6;
-  if (has_status()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      6, this->status(), output);
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_status(), target);
   }
 
   // optional int32 restart_id = 7;
-  if (has_restart_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->restart_id(), output);
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_restart_id(), target);
   }
 
   // optional uint64 time = 8;
-  if (has_time()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(8, this->time(), output);
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_time(), target);
   }
 
   // optional int32 thread_id = 9;
-  if (has_thread_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(9, this->thread_id(), output);
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_thread_id(), target);
   }
 
   // optional string label = 10;
-  if (has_label()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->label().data(), this->label().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "label");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      10, this->label(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_label().data(), static_cast<int>(this->_internal_label().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "message.Node.label");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_label(), target);
   }
 
   // optional float domain_size = 11;
-  if (has_domain_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(11, this->domain_size(), output);
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(11, this->_internal_domain_size(), target);
   }
 
   // optional string solution = 12;
-  if (has_solution()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->solution().data(), this->solution().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "solution");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      12, this->solution(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_solution().data(), static_cast<int>(this->_internal_solution().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "message.Node.solution");
+    target = stream->WriteStringMaybeAliased(
+        12, this->_internal_solution(), target);
   }
 
   // optional string nogood = 13;
-  if (has_nogood()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->nogood().data(), this->nogood().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "nogood");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      13, this->nogood(), output);
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_nogood().data(), static_cast<int>(this->_internal_nogood().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "message.Node.nogood");
+    target = stream->WriteStringMaybeAliased(
+        13, this->_internal_nogood(), target);
   }
 
   // optional string info = 14;
-  if (has_info()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->info().data(), this->info().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "info");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      14, this->info(), output);
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_info().data(), static_cast<int>(this->_internal_info().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "message.Node.info");
+    target = stream->WriteStringMaybeAliased(
+        14, this->_internal_info(), target);
   }
 
   // optional int32 nogood_bld = 15;
-  if (has_nogood_bld()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(15, this->nogood_bld(), output);
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(15, this->_internal_nogood_bld(), target);
   }
 
   // optional bool uses_assumptions = 16;
-  if (has_uses_assumptions()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(16, this->uses_assumptions(), output);
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(16, this->_internal_uses_assumptions(), target);
   }
 
   // optional int32 backjump_distance = 17;
-  if (has_backjump_distance()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(17, this->backjump_distance(), output);
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(17, this->_internal_backjump_distance(), target);
   }
 
   // optional int32 decision_level = 18;
-  if (has_decision_level()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(18, this->decision_level(), output);
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(18, this->_internal_decision_level(), target);
+  }
+
+  // optional .message.NodeBatch batch = 19;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(19, _Internal::batch(this),
+        _Internal::batch(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 credit = 20;
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(20, this->_internal_credit(), target);
+  }
+
+  // optional bool flow_control = 21;
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(21, this->_internal_flow_control(), target);
+  }
+
+  // repeated string labels = 22;
+  for (int i = 0, n = this->_internal_labels_size(); i < n; i++) {
+    const auto& s = this->_internal_labels(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "message.Node.labels");
+    target = stream->WriteString(22, s, target);
+  }
+
+  // optional int32 first_label_id = 23;
+  if (cached_has_bits & 0x00200000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(23, this->_internal_first_label_id(), target);
+  }
+
+  // optional int32 label_id = 24;
+  if (cached_has_bits & 0x00400000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(24, this->_internal_label_id(), target);
+  }
+
+  // optional .message.Node.Encoding encoding = 25;
+  if (cached_has_bits & 0x00800000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      25, this->_internal_encoding(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:message.Node)
+  // @@protoc_insertion_point(serialize_to_array_end:message.Node)
+  return target;
 }
 
-::google::protobuf::uint8* Node::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:message.Node)
+size_t Node::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:message.Node)
+  size_t total_size = 0;
+
   // required .message.Node.MsgType type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string labels = 22;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.labels_.size());
+  for (int i = 0, n = _impl_.labels_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.labels_.Get(i));
   }
 
-  // optional int32 sid = 2;
-  if (has_sid()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->sid(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional string label = 10;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_label());
+    }
+
+    // optional string solution = 12;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_solution());
+    }
+
+    // optional string nogood = 13;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_nogood());
+    }
+
+    // optional string info = 14;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_info());
+    }
+
+    // optional .message.NodeBatch batch = 19;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.batch_);
+    }
+
   }
+  if (cached_has_bits & 0x000000c0u) {
+    // optional int32 sid = 2;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sid());
+    }
+
+    // optional int32 pid = 3;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_pid());
+    }
 
-  // optional int32 pid = 3;
-  if (has_pid()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->pid(), target);
   }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional int32 alt = 4;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_alt());
+    }
+
+    // optional int32 kids = 5;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_kids());
+    }
+
+    // optional .message.Node.NodeStatus status = 6;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+    }
+
+    // optional uint64 time = 8;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time());
+    }
+
+    // optional int32 restart_id = 7;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_restart_id());
+    }
+
+    // optional int32 thread_id = 9;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_thread_id());
+    }
+
+    // optional float domain_size = 11;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 nogood_bld = 15;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_nogood_bld());
+    }
 
-  // optional int32 alt = 4;
-  if (has_alt()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->alt(), target);
   }
+  if (cached_has_bits & 0x00ff0000u) {
+    // optional int32 backjump_distance = 17;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_backjump_distance());
+    }
+
+    // optional int32 decision_level = 18;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_decision_level());
+    }
+
+    // optional int64 credit = 20;
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int64Size(
+          this->_internal_credit());
+    }
+
+    // optional bool uses_assumptions = 16;
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 2 + 1;
+    }
+
+    // optional bool flow_control = 21;
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 2 + 1;
+    }
+
+    // optional int32 first_label_id = 23;
+    if (cached_has_bits & 0x00200000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_first_label_id());
+    }
+
+    // optional int32 label_id = 24;
+    if (cached_has_bits & 0x00400000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_label_id());
+    }
+
+    // optional .message.Node.Encoding encoding = 25;
+    if (cached_has_bits & 0x00800000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
+    }
 
-  // optional int32 kids = 5;
-  if (has_kids()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->kids(), target);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-  // optional .message.Node.NodeStatus status = 6;
-  if (has_status()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      6, this->status(), target);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Node::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Node::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Node::GetClassData() const { return &_class_data_; }
+
+
+void Node::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Node*>(&to_msg);
+  auto& from = static_cast<const Node&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:message.Node)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.labels_.MergeFrom(from._impl_.labels_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_label(from._internal_label());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_solution(from._internal_solution());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_nogood(from._internal_nogood());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_info(from._internal_info());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_batch()->::message::NodeBatch::MergeFrom(
+          from._internal_batch());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.sid_ = from._impl_.sid_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.pid_ = from._impl_.pid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.alt_ = from._impl_.alt_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.kids_ = from._impl_.kids_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.status_ = from._impl_.status_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.time_ = from._impl_.time_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.restart_id_ = from._impl_.restart_id_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.thread_id_ = from._impl_.thread_id_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.domain_size_ = from._impl_.domain_size_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.nogood_bld_ = from._impl_.nogood_bld_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  if (cached_has_bits & 0x00ff0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.backjump_distance_ = from._impl_.backjump_distance_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.decision_level_ = from._impl_.decision_level_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.credit_ = from._impl_.credit_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      _this->_impl_.uses_assumptions_ = from._impl_.uses_assumptions_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      _this->_impl_.flow_control_ = from._impl_.flow_control_;
+    }
+    if (cached_has_bits & 0x00200000u) {
+      _this->_impl_.first_label_id_ = from._impl_.first_label_id_;
+    }
+    if (cached_has_bits & 0x00400000u) {
+      _this->_impl_.label_id_ = from._impl_.label_id_;
+    }
+    if (cached_has_bits & 0x00800000u) {
+      _this->_impl_.encoding_ = from._impl_.encoding_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-  // optional int32 restart_id = 7;
-  if (has_restart_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->restart_id(), target);
+void Node::CopyFrom(const Node& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:message.Node)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Node::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Node::InternalSwap(Node* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.labels_.InternalSwap(&other->_impl_.labels_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.label_, lhs_arena,
+      &other->_impl_.label_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.solution_, lhs_arena,
+      &other->_impl_.solution_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.nogood_, lhs_arena,
+      &other->_impl_.nogood_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.info_, lhs_arena,
+      &other->_impl_.info_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Node, _impl_.encoding_)
+      + sizeof(Node::_impl_.encoding_)
+      - PROTOBUF_FIELD_OFFSET(Node, _impl_.batch_)>(
+          reinterpret_cast<char*>(&_impl_.batch_),
+          reinterpret_cast<char*>(&other->_impl_.batch_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Node::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[0]);
+}
+
+// ===================================================================
+
+class NodeBatch::_Internal {
+ public:
+};
+
+NodeBatch::NodeBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:message.NodeBatch)
+}
+NodeBatch::NodeBatch(const NodeBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NodeBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sid_){from._impl_.sid_}
+    , /*decltype(_impl_._sid_cached_byte_size_)*/{0}
+    , decltype(_impl_.pid_){from._impl_.pid_}
+    , /*decltype(_impl_._pid_cached_byte_size_)*/{0}
+    , decltype(_impl_.alt_){from._impl_.alt_}
+    , /*decltype(_impl_._alt_cached_byte_size_)*/{0}
+    , decltype(_impl_.kids_){from._impl_.kids_}
+    , /*decltype(_impl_._kids_cached_byte_size_)*/{0}
+    , decltype(_impl_.status_){from._impl_.status_}
+    , /*decltype(_impl_._status_cached_byte_size_)*/{0}
+    , decltype(_impl_.restart_id_){from._impl_.restart_id_}
+    , /*decltype(_impl_._restart_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.time_){from._impl_.time_}
+    , /*decltype(_impl_._time_cached_byte_size_)*/{0}
+    , decltype(_impl_.thread_id_){from._impl_.thread_id_}
+    , /*decltype(_impl_._thread_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.label_){from._impl_.label_}
+    , /*decltype(_impl_._label_cached_byte_size_)*/{0}
+    , decltype(_impl_.label_table_){from._impl_.label_table_}
+    , decltype(_impl_.domain_size_){from._impl_.domain_size_}
+    , decltype(_impl_.decision_level_){from._impl_.decision_level_}
+    , /*decltype(_impl_._decision_level_cached_byte_size_)*/{0}
+    , decltype(_impl_.nogood_idx_){from._impl_.nogood_idx_}
+    , /*decltype(_impl_._nogood_idx_cached_byte_size_)*/{0}
+    , decltype(_impl_.nogood_){from._impl_.nogood_}
+    , decltype(_impl_.info_idx_){from._impl_.info_idx_}
+    , /*decltype(_impl_._info_idx_cached_byte_size_)*/{0}
+    , decltype(_impl_.info_){from._impl_.info_}
+    , decltype(_impl_.label_id_){from._impl_.label_id_}
+    , /*decltype(_impl_._label_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.sid_delta_){from._impl_.sid_delta_}
+    , /*decltype(_impl_._sid_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.pid_delta_){from._impl_.pid_delta_}
+    , /*decltype(_impl_._pid_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.time_delta_){from._impl_.time_delta_}
+    , /*decltype(_impl_._time_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.nogood_bld_){from._impl_.nogood_bld_}
+    , /*decltype(_impl_._nogood_bld_cached_byte_size_)*/{0}
+    , decltype(_impl_.uses_assumptions_){from._impl_.uses_assumptions_}
+    , decltype(_impl_.backjump_distance_){from._impl_.backjump_distance_}
+    , /*decltype(_impl_._backjump_distance_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:message.NodeBatch)
+}
+
+inline void NodeBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sid_){arena}
+    , /*decltype(_impl_._sid_cached_byte_size_)*/{0}
+    , decltype(_impl_.pid_){arena}
+    , /*decltype(_impl_._pid_cached_byte_size_)*/{0}
+    , decltype(_impl_.alt_){arena}
+    , /*decltype(_impl_._alt_cached_byte_size_)*/{0}
+    , decltype(_impl_.kids_){arena}
+    , /*decltype(_impl_._kids_cached_byte_size_)*/{0}
+    , decltype(_impl_.status_){arena}
+    , /*decltype(_impl_._status_cached_byte_size_)*/{0}
+    , decltype(_impl_.restart_id_){arena}
+    , /*decltype(_impl_._restart_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.time_){arena}
+    , /*decltype(_impl_._time_cached_byte_size_)*/{0}
+    , decltype(_impl_.thread_id_){arena}
+    , /*decltype(_impl_._thread_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.label_){arena}
+    , /*decltype(_impl_._label_cached_byte_size_)*/{0}
+    , decltype(_impl_.label_table_){arena}
+    , decltype(_impl_.domain_size_){arena}
+    , decltype(_impl_.decision_level_){arena}
+    , /*decltype(_impl_._decision_level_cached_byte_size_)*/{0}
+    , decltype(_impl_.nogood_idx_){arena}
+    , /*decltype(_impl_._nogood_idx_cached_byte_size_)*/{0}
+    , decltype(_impl_.nogood_){arena}
+    , decltype(_impl_.info_idx_){arena}
+    , /*decltype(_impl_._info_idx_cached_byte_size_)*/{0}
+    , decltype(_impl_.info_){arena}
+    , decltype(_impl_.label_id_){arena}
+    , /*decltype(_impl_._label_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.sid_delta_){arena}
+    , /*decltype(_impl_._sid_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.pid_delta_){arena}
+    , /*decltype(_impl_._pid_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.time_delta_){arena}
+    , /*decltype(_impl_._time_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.nogood_bld_){arena}
+    , /*decltype(_impl_._nogood_bld_cached_byte_size_)*/{0}
+    , decltype(_impl_.uses_assumptions_){arena}
+    , decltype(_impl_.backjump_distance_){arena}
+    , /*decltype(_impl_._backjump_distance_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+NodeBatch::~NodeBatch() {
+  // @@protoc_insertion_point(destructor:message.NodeBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  // optional uint64 time = 8;
-  if (has_time()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(8, this->time(), target);
+inline void NodeBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sid_.~RepeatedField();
+  _impl_.pid_.~RepeatedField();
+  _impl_.alt_.~RepeatedField();
+  _impl_.kids_.~RepeatedField();
+  _impl_.status_.~RepeatedField();
+  _impl_.restart_id_.~RepeatedField();
+  _impl_.time_.~RepeatedField();
+  _impl_.thread_id_.~RepeatedField();
+  _impl_.label_.~RepeatedField();
+  _impl_.label_table_.~RepeatedPtrField();
+  _impl_.domain_size_.~RepeatedField();
+  _impl_.decision_level_.~RepeatedField();
+  _impl_.nogood_idx_.~RepeatedField();
+  _impl_.nogood_.~RepeatedPtrField();
+  _impl_.info_idx_.~RepeatedField();
+  _impl_.info_.~RepeatedPtrField();
+  _impl_.label_id_.~RepeatedField();
+  _impl_.sid_delta_.~RepeatedField();
+  _impl_.pid_delta_.~RepeatedField();
+  _impl_.time_delta_.~RepeatedField();
+  _impl_.nogood_bld_.~RepeatedField();
+  _impl_.uses_assumptions_.~RepeatedField();
+  _impl_.backjump_distance_.~RepeatedField();
+}
+
+void NodeBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NodeBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:message.NodeBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sid_.Clear();
+  _impl_.pid_.Clear();
+  _impl_.alt_.Clear();
+  _impl_.kids_.Clear();
+  _impl_.status_.Clear();
+  _impl_.restart_id_.Clear();
+  _impl_.time_.Clear();
+  _impl_.thread_id_.Clear();
+  _impl_.label_.Clear();
+  _impl_.label_table_.Clear();
+  _impl_.domain_size_.Clear();
+  _impl_.decision_level_.Clear();
+  _impl_.nogood_idx_.Clear();
+  _impl_.nogood_.Clear();
+  _impl_.info_idx_.Clear();
+  _impl_.info_.Clear();
+  _impl_.label_id_.Clear();
+  _impl_.sid_delta_.Clear();
+  _impl_.pid_delta_.Clear();
+  _impl_.time_delta_.Clear();
+  _impl_.nogood_bld_.Clear();
+  _impl_.uses_assumptions_.Clear();
+  _impl_.backjump_distance_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NodeBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int32 sid = 1 [packed = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_sid(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_sid(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 pid = 2 [packed = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_pid(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_pid(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 alt = 3 [packed = true];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_alt(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_alt(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 kids = 4 [packed = true];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_kids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_kids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 status = 5 [packed = true];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_status(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_status(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 restart_id = 6 [packed = true];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_restart_id(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_restart_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 time = 7 [packed = true];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_time(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_time(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 thread_id = 8 [packed = true];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_thread_id(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_thread_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 label = 9 [packed = true];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_label(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_label(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string label_table = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_label_table();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "message.NodeBatch.label_table");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float domain_size = 11 [packed = true];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_domain_size(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 93) {
+          _internal_add_domain_size(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 decision_level = 12 [packed = true];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_decision_level(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 96) {
+          _internal_add_decision_level(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 nogood_idx = 13 [packed = true];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_nogood_idx(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 104) {
+          _internal_add_nogood_idx(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string nogood = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_nogood();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "message.NodeBatch.nogood");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<114>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 info_idx = 15 [packed = true];
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_info_idx(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 120) {
+          _internal_add_info_idx(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string info = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_info();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "message.NodeBatch.info");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<130>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 label_id = 17 [packed = true];
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_label_id(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 136) {
+          _internal_add_label_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 sid_delta = 18 [packed = true];
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_sid_delta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 144) {
+          _internal_add_sid_delta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 pid_delta = 19 [packed = true];
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_pid_delta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 152) {
+          _internal_add_pid_delta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint64 time_delta = 20 [packed = true];
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(_internal_mutable_time_delta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 160) {
+          _internal_add_time_delta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 nogood_bld = 21 [packed = true];
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_nogood_bld(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 168) {
+          _internal_add_nogood_bld(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bool uses_assumptions = 22 [packed = true];
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(_internal_mutable_uses_assumptions(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 176) {
+          _internal_add_uses_assumptions(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 backjump_distance = 23 [packed = true];
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 186)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_backjump_distance(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 184) {
+          _internal_add_backjump_distance(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NodeBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:message.NodeBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 sid = 1 [packed = true];
+  {
+    int byte_size = _impl_._sid_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          1, _internal_sid(), byte_size, target);
+    }
   }
 
-  // optional int32 thread_id = 9;
-  if (has_thread_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(9, this->thread_id(), target);
+  // repeated int32 pid = 2 [packed = true];
+  {
+    int byte_size = _impl_._pid_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_pid(), byte_size, target);
+    }
   }
 
-  // optional string label = 10;
-  if (has_label()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->label().data(), this->label().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "label");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        10, this->label(), target);
+  // repeated int32 alt = 3 [packed = true];
+  {
+    int byte_size = _impl_._alt_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          3, _internal_alt(), byte_size, target);
+    }
   }
 
-  // optional float domain_size = 11;
-  if (has_domain_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(11, this->domain_size(), target);
+  // repeated int32 kids = 4 [packed = true];
+  {
+    int byte_size = _impl_._kids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          4, _internal_kids(), byte_size, target);
+    }
   }
 
-  // optional string solution = 12;
-  if (has_solution()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->solution().data(), this->solution().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "solution");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        12, this->solution(), target);
+  // repeated int32 status = 5 [packed = true];
+  {
+    int byte_size = _impl_._status_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          5, _internal_status(), byte_size, target);
+    }
   }
 
-  // optional string nogood = 13;
-  if (has_nogood()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->nogood().data(), this->nogood().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "nogood");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        13, this->nogood(), target);
+  // repeated int32 restart_id = 6 [packed = true];
+  {
+    int byte_size = _impl_._restart_id_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          6, _internal_restart_id(), byte_size, target);
+    }
   }
 
-  // optional string info = 14;
-  if (has_info()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->info().data(), this->info().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "info");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        14, this->info(), target);
+  // repeated uint64 time = 7 [packed = true];
+  {
+    int byte_size = _impl_._time_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          7, _internal_time(), byte_size, target);
+    }
   }
 
-  // optional int32 nogood_bld = 15;
-  if (has_nogood_bld()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(15, this->nogood_bld(), target);
+  // repeated int32 thread_id = 8 [packed = true];
+  {
+    int byte_size = _impl_._thread_id_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          8, _internal_thread_id(), byte_size, target);
+    }
   }
 
-  // optional bool uses_assumptions = 16;
-  if (has_uses_assumptions()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(16, this->uses_assumptions(), target);
+  // repeated int32 label = 9 [packed = true];
+  {
+    int byte_size = _impl_._label_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          9, _internal_label(), byte_size, target);
+    }
   }
 
-  // optional int32 backjump_distance = 17;
-  if (has_backjump_distance()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(17, this->backjump_distance(), target);
+  // repeated string label_table = 10;
+  for (int i = 0, n = this->_internal_label_table_size(); i < n; i++) {
+    const auto& s = this->_internal_label_table(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "message.NodeBatch.label_table");
+    target = stream->WriteString(10, s, target);
   }
 
-  // optional int32 decision_level = 18;
-  if (has_decision_level()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(18, this->decision_level(), target);
+  // repeated float domain_size = 11 [packed = true];
+  if (this->_internal_domain_size_size() > 0) {
+    target = stream->WriteFixedPacked(11, _internal_domain_size(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // repeated int32 decision_level = 12 [packed = true];
+  {
+    int byte_size = _impl_._decision_level_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          12, _internal_decision_level(), byte_size, target);
+    }
   }
-  // @@protoc_insertion_point(serialize_to_array_end:message.Node)
-  return target;
-}
 
-int Node::ByteSize() const {
-  int total_size = 0;
+  // repeated int32 nogood_idx = 13 [packed = true];
+  {
+    int byte_size = _impl_._nogood_idx_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          13, _internal_nogood_idx(), byte_size, target);
+    }
+  }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .message.Node.MsgType type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+  // repeated string nogood = 14;
+  for (int i = 0, n = this->_internal_nogood_size(); i < n; i++) {
+    const auto& s = this->_internal_nogood(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "message.NodeBatch.nogood");
+    target = stream->WriteString(14, s, target);
+  }
+
+  // repeated int32 info_idx = 15 [packed = true];
+  {
+    int byte_size = _impl_._info_idx_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          15, _internal_info_idx(), byte_size, target);
     }
+  }
 
-    // optional int32 sid = 2;
-    if (has_sid()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->sid());
+  // repeated string info = 16;
+  for (int i = 0, n = this->_internal_info_size(); i < n; i++) {
+    const auto& s = this->_internal_info(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "message.NodeBatch.info");
+    target = stream->WriteString(16, s, target);
+  }
+
+  // repeated int32 label_id = 17 [packed = true];
+  {
+    int byte_size = _impl_._label_id_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          17, _internal_label_id(), byte_size, target);
     }
+  }
 
-    // optional int32 pid = 3;
-    if (has_pid()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->pid());
+  // repeated sint32 sid_delta = 18 [packed = true];
+  {
+    int byte_size = _impl_._sid_delta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          18, _internal_sid_delta(), byte_size, target);
     }
+  }
 
-    // optional int32 alt = 4;
-    if (has_alt()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->alt());
+  // repeated sint32 pid_delta = 19 [packed = true];
+  {
+    int byte_size = _impl_._pid_delta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          19, _internal_pid_delta(), byte_size, target);
+    }
+  }
+
+  // repeated sint64 time_delta = 20 [packed = true];
+  {
+    int byte_size = _impl_._time_delta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt64Packed(
+          20, _internal_time_delta(), byte_size, target);
     }
+  }
 
-    // optional int32 kids = 5;
-    if (has_kids()) {
+  // repeated int32 nogood_bld = 21 [packed = true];
+  {
+    int byte_size = _impl_._nogood_bld_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          21, _internal_nogood_bld(), byte_size, target);
+    }
+  }
+
+  // repeated bool uses_assumptions = 22 [packed = true];
+  if (this->_internal_uses_assumptions_size() > 0) {
+    target = stream->WriteFixedPacked(22, _internal_uses_assumptions(), target);
+  }
+
+  // repeated int32 backjump_distance = 23 [packed = true];
+  {
+    int byte_size = _impl_._backjump_distance_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          23, _internal_backjump_distance(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:message.NodeBatch)
+  return target;
+}
+
+size_t NodeBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:message.NodeBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 sid = 1 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.sid_);
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->kids());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._sid_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-    // optional .message.Node.NodeStatus status = 6;
-    if (has_status()) {
+  // repeated int32 pid = 2 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.pid_);
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->status());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._pid_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-    // optional int32 restart_id = 7;
-    if (has_restart_id()) {
+  // repeated int32 alt = 3 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.alt_);
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->restart_id());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._alt_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-    // optional uint64 time = 8;
-    if (has_time()) {
+  // repeated int32 kids = 4 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.kids_);
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->time());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._kids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
+  // repeated int32 status = 5 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.status_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._status_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    // optional int32 thread_id = 9;
-    if (has_thread_id()) {
+
+  // repeated int32 restart_id = 6 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.restart_id_);
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->thread_id());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._restart_id_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-    // optional string label = 10;
-    if (has_label()) {
+  // repeated uint64 time = 7 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.time_);
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->label());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._time_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-    // optional float domain_size = 11;
-    if (has_domain_size()) {
-      total_size += 1 + 4;
+  // repeated int32 thread_id = 8 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.thread_id_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._thread_id_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-    // optional string solution = 12;
-    if (has_solution()) {
+  // repeated int32 label = 9 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.label_);
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->solution());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._label_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-    // optional string nogood = 13;
-    if (has_nogood()) {
+  // repeated string label_table = 10;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.label_table_.size());
+  for (int i = 0, n = _impl_.label_table_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.label_table_.Get(i));
+  }
+
+  // repeated float domain_size = 11 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_domain_size_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->nogood());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    total_size += data_size;
+  }
 
-    // optional string info = 14;
-    if (has_info()) {
+  // repeated int32 decision_level = 12 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.decision_level_);
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->info());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._decision_level_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-    // optional int32 nogood_bld = 15;
-    if (has_nogood_bld()) {
+  // repeated int32 nogood_idx = 13 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.nogood_idx_);
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->nogood_bld());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nogood_idx_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-    // optional bool uses_assumptions = 16;
-    if (has_uses_assumptions()) {
-      total_size += 2 + 1;
+  // repeated string nogood = 14;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.nogood_.size());
+  for (int i = 0, n = _impl_.nogood_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.nogood_.Get(i));
+  }
+
+  // repeated int32 info_idx = 15 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.info_idx_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._info_idx_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
+  // repeated string info = 16;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.info_.size());
+  for (int i = 0, n = _impl_.info_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.info_.Get(i));
   }
-  if (_has_bits_[16 / 32] & (0xffu << (16 % 32))) {
-    // optional int32 backjump_distance = 17;
-    if (has_backjump_distance()) {
+
+  // repeated int32 label_id = 17 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.label_id_);
+    if (data_size > 0) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->backjump_distance());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._label_id_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
 
-    // optional int32 decision_level = 18;
-    if (has_decision_level()) {
+  // repeated sint32 sid_delta = 18 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.sid_delta_);
+    if (data_size > 0) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->decision_level());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._sid_delta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Node::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Node* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Node*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // repeated sint32 pid_delta = 19 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.pid_delta_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._pid_delta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-}
 
-void Node::MergeFrom(const Node& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
-    }
-    if (from.has_sid()) {
-      set_sid(from.sid());
-    }
-    if (from.has_pid()) {
-      set_pid(from.pid());
-    }
-    if (from.has_alt()) {
-      set_alt(from.alt());
-    }
-    if (from.has_kids()) {
-      set_kids(from.kids());
-    }
-    if (from.has_status()) {
-      set_status(from.status());
-    }
-    if (from.has_restart_id()) {
-      set_restart_id(from.restart_id());
-    }
-    if (from.has_time()) {
-      set_time(from.time());
+  // repeated sint64 time_delta = 20 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt64Size(this->_impl_.time_delta_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._time_delta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_thread_id()) {
-      set_thread_id(from.thread_id());
-    }
-    if (from.has_label()) {
-      set_label(from.label());
-    }
-    if (from.has_domain_size()) {
-      set_domain_size(from.domain_size());
-    }
-    if (from.has_solution()) {
-      set_solution(from.solution());
-    }
-    if (from.has_nogood()) {
-      set_nogood(from.nogood());
-    }
-    if (from.has_info()) {
-      set_info(from.info());
-    }
-    if (from.has_nogood_bld()) {
-      set_nogood_bld(from.nogood_bld());
-    }
-    if (from.has_uses_assumptions()) {
-      set_uses_assumptions(from.uses_assumptions());
+
+  // repeated int32 nogood_bld = 21 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.nogood_bld_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nogood_bld_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  if (from._has_bits_[16 / 32] & (0xffu << (16 % 32))) {
-    if (from.has_backjump_distance()) {
-      set_backjump_distance(from.backjump_distance());
+
+  // repeated bool uses_assumptions = 22 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_uses_assumptions_size());
+    size_t data_size = 1UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    if (from.has_decision_level()) {
-      set_decision_level(from.decision_level());
+    total_size += data_size;
+  }
+
+  // repeated int32 backjump_distance = 23 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.backjump_distance_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._backjump_distance_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Node::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NodeBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NodeBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NodeBatch::GetClassData() const { return &_class_data_; }
+
+
+void NodeBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NodeBatch*>(&to_msg);
+  auto& from = static_cast<const NodeBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:message.NodeBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sid_.MergeFrom(from._impl_.sid_);
+  _this->_impl_.pid_.MergeFrom(from._impl_.pid_);
+  _this->_impl_.alt_.MergeFrom(from._impl_.alt_);
+  _this->_impl_.kids_.MergeFrom(from._impl_.kids_);
+  _this->_impl_.status_.MergeFrom(from._impl_.status_);
+  _this->_impl_.restart_id_.MergeFrom(from._impl_.restart_id_);
+  _this->_impl_.time_.MergeFrom(from._impl_.time_);
+  _this->_impl_.thread_id_.MergeFrom(from._impl_.thread_id_);
+  _this->_impl_.label_.MergeFrom(from._impl_.label_);
+  _this->_impl_.label_table_.MergeFrom(from._impl_.label_table_);
+  _this->_impl_.domain_size_.MergeFrom(from._impl_.domain_size_);
+  _this->_impl_.decision_level_.MergeFrom(from._impl_.decision_level_);
+  _this->_impl_.nogood_idx_.MergeFrom(from._impl_.nogood_idx_);
+  _this->_impl_.nogood_.MergeFrom(from._impl_.nogood_);
+  _this->_impl_.info_idx_.MergeFrom(from._impl_.info_idx_);
+  _this->_impl_.info_.MergeFrom(from._impl_.info_);
+  _this->_impl_.label_id_.MergeFrom(from._impl_.label_id_);
+  _this->_impl_.sid_delta_.MergeFrom(from._impl_.sid_delta_);
+  _this->_impl_.pid_delta_.MergeFrom(from._impl_.pid_delta_);
+  _this->_impl_.time_delta_.MergeFrom(from._impl_.time_delta_);
+  _this->_impl_.nogood_bld_.MergeFrom(from._impl_.nogood_bld_);
+  _this->_impl_.uses_assumptions_.MergeFrom(from._impl_.uses_assumptions_);
+  _this->_impl_.backjump_distance_.MergeFrom(from._impl_.backjump_distance_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Node::CopyFrom(const Node& from) {
+void NodeBatch::CopyFrom(const NodeBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:message.NodeBatch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Node::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+bool NodeBatch::IsInitialized() const {
   return true;
 }
 
-void Node::Swap(Node* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(sid_, other->sid_);
-    std::swap(pid_, other->pid_);
-    std::swap(alt_, other->alt_);
-    std::swap(kids_, other->kids_);
-    std::swap(status_, other->status_);
-    std::swap(restart_id_, other->restart_id_);
-    std::swap(time_, other->time_);
-    std::swap(thread_id_, other->thread_id_);
-    std::swap(label_, other->label_);
-    std::swap(domain_size_, other->domain_size_);
-    std::swap(solution_, other->solution_);
-    std::swap(nogood_, other->nogood_);
-    std::swap(info_, other->info_);
-    std::swap(nogood_bld_, other->nogood_bld_);
-    std::swap(uses_assumptions_, other->uses_assumptions_);
-    std::swap(backjump_distance_, other->backjump_distance_);
-    std::swap(decision_level_, other->decision_level_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void NodeBatch::InternalSwap(NodeBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.sid_.InternalSwap(&other->_impl_.sid_);
+  _impl_.pid_.InternalSwap(&other->_impl_.pid_);
+  _impl_.alt_.InternalSwap(&other->_impl_.alt_);
+  _impl_.kids_.InternalSwap(&other->_impl_.kids_);
+  _impl_.status_.InternalSwap(&other->_impl_.status_);
+  _impl_.restart_id_.InternalSwap(&other->_impl_.restart_id_);
+  _impl_.time_.InternalSwap(&other->_impl_.time_);
+  _impl_.thread_id_.InternalSwap(&other->_impl_.thread_id_);
+  _impl_.label_.InternalSwap(&other->_impl_.label_);
+  _impl_.label_table_.InternalSwap(&other->_impl_.label_table_);
+  _impl_.domain_size_.InternalSwap(&other->_impl_.domain_size_);
+  _impl_.decision_level_.InternalSwap(&other->_impl_.decision_level_);
+  _impl_.nogood_idx_.InternalSwap(&other->_impl_.nogood_idx_);
+  _impl_.nogood_.InternalSwap(&other->_impl_.nogood_);
+  _impl_.info_idx_.InternalSwap(&other->_impl_.info_idx_);
+  _impl_.info_.InternalSwap(&other->_impl_.info_);
+  _impl_.label_id_.InternalSwap(&other->_impl_.label_id_);
+  _impl_.sid_delta_.InternalSwap(&other->_impl_.sid_delta_);
+  _impl_.pid_delta_.InternalSwap(&other->_impl_.pid_delta_);
+  _impl_.time_delta_.InternalSwap(&other->_impl_.time_delta_);
+  _impl_.nogood_bld_.InternalSwap(&other->_impl_.nogood_bld_);
+  _impl_.uses_assumptions_.InternalSwap(&other->_impl_.uses_assumptions_);
+  _impl_.backjump_distance_.InternalSwap(&other->_impl_.backjump_distance_);
 }
 
-::google::protobuf::Metadata Node::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Node_descriptor_;
-  metadata.reflection = Node_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata NodeBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[1]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace message
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::message::Node*
+Arena::CreateMaybeMessage< ::message::Node >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::Node >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::NodeBatch*
+Arena::CreateMaybeMessage< ::message::NodeBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::NodeBatch >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
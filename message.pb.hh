@@ -1,62 +1,93 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: message.proto
 
-#ifndef PROTOBUF_message_2eproto__INCLUDED
-#define PROTOBUF_message_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_message_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_message_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2006000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_message_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_message_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_message_2eproto;
 namespace message {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_message_2eproto();
-void protobuf_AssignDesc_message_2eproto();
-void protobuf_ShutdownFile_message_2eproto();
-
 class Node;
+struct NodeDefaultTypeInternal;
+extern NodeDefaultTypeInternal _Node_default_instance_;
+class NodeBatch;
+struct NodeBatchDefaultTypeInternal;
+extern NodeBatchDefaultTypeInternal _NodeBatch_default_instance_;
+}  // namespace message
+PROTOBUF_NAMESPACE_OPEN
+template<> ::message::Node* Arena::CreateMaybeMessage<::message::Node>(Arena*);
+template<> ::message::NodeBatch* Arena::CreateMaybeMessage<::message::NodeBatch>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace message {
 
-enum Node_MsgType {
+enum Node_MsgType : int {
   Node_MsgType_NODE = 0,
   Node_MsgType_DONE = 1,
-  Node_MsgType_START = 2
+  Node_MsgType_START = 2,
+  Node_MsgType_NODE_BATCH = 3,
+  Node_MsgType_ATTACH_SHM = 4,
+  Node_MsgType_CREDIT = 5,
+  Node_MsgType_LABEL_DICT = 6
 };
 bool Node_MsgType_IsValid(int value);
-const Node_MsgType Node_MsgType_MsgType_MIN = Node_MsgType_NODE;
-const Node_MsgType Node_MsgType_MsgType_MAX = Node_MsgType_START;
-const int Node_MsgType_MsgType_ARRAYSIZE = Node_MsgType_MsgType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Node_MsgType_descriptor();
-inline const ::std::string& Node_MsgType_Name(Node_MsgType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Node_MsgType_descriptor(), value);
+constexpr Node_MsgType Node_MsgType_MsgType_MIN = Node_MsgType_NODE;
+constexpr Node_MsgType Node_MsgType_MsgType_MAX = Node_MsgType_LABEL_DICT;
+constexpr int Node_MsgType_MsgType_ARRAYSIZE = Node_MsgType_MsgType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Node_MsgType_descriptor();
+template<typename T>
+inline const std::string& Node_MsgType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Node_MsgType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Node_MsgType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Node_MsgType_descriptor(), enum_t_value);
 }
 inline bool Node_MsgType_Parse(
-    const ::std::string& name, Node_MsgType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Node_MsgType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Node_MsgType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Node_MsgType>(
     Node_MsgType_descriptor(), name, value);
 }
-enum Node_NodeStatus {
+enum Node_NodeStatus : int {
   Node_NodeStatus_SOLVED = 0,
   Node_NodeStatus_FAILED = 1,
   Node_NodeStatus_BRANCH = 2,
@@ -67,1017 +98,3618 @@ enum Node_NodeStatus {
   Node_NodeStatus_MERGING = 7
 };
 bool Node_NodeStatus_IsValid(int value);
-const Node_NodeStatus Node_NodeStatus_NodeStatus_MIN = Node_NodeStatus_SOLVED;
-const Node_NodeStatus Node_NodeStatus_NodeStatus_MAX = Node_NodeStatus_MERGING;
-const int Node_NodeStatus_NodeStatus_ARRAYSIZE = Node_NodeStatus_NodeStatus_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Node_NodeStatus_descriptor();
-inline const ::std::string& Node_NodeStatus_Name(Node_NodeStatus value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Node_NodeStatus_descriptor(), value);
+constexpr Node_NodeStatus Node_NodeStatus_NodeStatus_MIN = Node_NodeStatus_SOLVED;
+constexpr Node_NodeStatus Node_NodeStatus_NodeStatus_MAX = Node_NodeStatus_MERGING;
+constexpr int Node_NodeStatus_NodeStatus_ARRAYSIZE = Node_NodeStatus_NodeStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Node_NodeStatus_descriptor();
+template<typename T>
+inline const std::string& Node_NodeStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Node_NodeStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Node_NodeStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Node_NodeStatus_descriptor(), enum_t_value);
 }
 inline bool Node_NodeStatus_Parse(
-    const ::std::string& name, Node_NodeStatus* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Node_NodeStatus>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Node_NodeStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Node_NodeStatus>(
     Node_NodeStatus_descriptor(), name, value);
 }
+enum Node_Encoding : int {
+  Node_Encoding_PLAIN = 0,
+  Node_Encoding_DELTA = 1
+};
+bool Node_Encoding_IsValid(int value);
+constexpr Node_Encoding Node_Encoding_Encoding_MIN = Node_Encoding_PLAIN;
+constexpr Node_Encoding Node_Encoding_Encoding_MAX = Node_Encoding_DELTA;
+constexpr int Node_Encoding_Encoding_ARRAYSIZE = Node_Encoding_Encoding_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Node_Encoding_descriptor();
+template<typename T>
+inline const std::string& Node_Encoding_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Node_Encoding>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Node_Encoding_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Node_Encoding_descriptor(), enum_t_value);
+}
+inline bool Node_Encoding_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Node_Encoding* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Node_Encoding>(
+    Node_Encoding_descriptor(), name, value);
+}
 // ===================================================================
 
-class Node : public ::google::protobuf::Message {
+class Node final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.Node) */ {
  public:
-  Node();
-  virtual ~Node();
+  inline Node() : Node(nullptr) {}
+  ~Node() override;
+  explicit PROTOBUF_CONSTEXPR Node(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Node(const Node& from);
+  Node(Node&& from) noexcept
+    : Node() {
+    *this = ::std::move(from);
+  }
 
   inline Node& operator=(const Node& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Node& operator=(Node&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Node& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Node& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Node* internal_default_instance() {
+    return reinterpret_cast<const Node*>(
+               &_Node_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(Node* other);
+  friend void swap(Node& a, Node& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Node* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Node* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Node* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Node* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Node>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Node& from);
-  void MergeFrom(const Node& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Node& from) {
+    Node::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Node* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.Node";
+  }
+  protected:
+  explicit Node(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  ::google::protobuf::Metadata GetMetadata() const;
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef Node_MsgType MsgType;
-  static const MsgType NODE = Node_MsgType_NODE;
-  static const MsgType DONE = Node_MsgType_DONE;
-  static const MsgType START = Node_MsgType_START;
+  static constexpr MsgType NODE =
+    Node_MsgType_NODE;
+  static constexpr MsgType DONE =
+    Node_MsgType_DONE;
+  static constexpr MsgType START =
+    Node_MsgType_START;
+  static constexpr MsgType NODE_BATCH =
+    Node_MsgType_NODE_BATCH;
+  static constexpr MsgType ATTACH_SHM =
+    Node_MsgType_ATTACH_SHM;
+  static constexpr MsgType CREDIT =
+    Node_MsgType_CREDIT;
+  static constexpr MsgType LABEL_DICT =
+    Node_MsgType_LABEL_DICT;
   static inline bool MsgType_IsValid(int value) {
     return Node_MsgType_IsValid(value);
   }
-  static const MsgType MsgType_MIN =
+  static constexpr MsgType MsgType_MIN =
     Node_MsgType_MsgType_MIN;
-  static const MsgType MsgType_MAX =
+  static constexpr MsgType MsgType_MAX =
     Node_MsgType_MsgType_MAX;
-  static const int MsgType_ARRAYSIZE =
+  static constexpr int MsgType_ARRAYSIZE =
     Node_MsgType_MsgType_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   MsgType_descriptor() {
     return Node_MsgType_descriptor();
   }
-  static inline const ::std::string& MsgType_Name(MsgType value) {
-    return Node_MsgType_Name(value);
+  template<typename T>
+  static inline const std::string& MsgType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, MsgType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function MsgType_Name.");
+    return Node_MsgType_Name(enum_t_value);
   }
-  static inline bool MsgType_Parse(const ::std::string& name,
+  static inline bool MsgType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       MsgType* value) {
     return Node_MsgType_Parse(name, value);
   }
 
   typedef Node_NodeStatus NodeStatus;
-  static const NodeStatus SOLVED = Node_NodeStatus_SOLVED;
-  static const NodeStatus FAILED = Node_NodeStatus_FAILED;
-  static const NodeStatus BRANCH = Node_NodeStatus_BRANCH;
-  static const NodeStatus UNDETERMINED = Node_NodeStatus_UNDETERMINED;
-  static const NodeStatus STOP = Node_NodeStatus_STOP;
-  static const NodeStatus UNSTOP = Node_NodeStatus_UNSTOP;
-  static const NodeStatus SKIPPED = Node_NodeStatus_SKIPPED;
-  static const NodeStatus MERGING = Node_NodeStatus_MERGING;
+  static constexpr NodeStatus SOLVED =
+    Node_NodeStatus_SOLVED;
+  static constexpr NodeStatus FAILED =
+    Node_NodeStatus_FAILED;
+  static constexpr NodeStatus BRANCH =
+    Node_NodeStatus_BRANCH;
+  static constexpr NodeStatus UNDETERMINED =
+    Node_NodeStatus_UNDETERMINED;
+  static constexpr NodeStatus STOP =
+    Node_NodeStatus_STOP;
+  static constexpr NodeStatus UNSTOP =
+    Node_NodeStatus_UNSTOP;
+  static constexpr NodeStatus SKIPPED =
+    Node_NodeStatus_SKIPPED;
+  static constexpr NodeStatus MERGING =
+    Node_NodeStatus_MERGING;
   static inline bool NodeStatus_IsValid(int value) {
     return Node_NodeStatus_IsValid(value);
   }
-  static const NodeStatus NodeStatus_MIN =
+  static constexpr NodeStatus NodeStatus_MIN =
     Node_NodeStatus_NodeStatus_MIN;
-  static const NodeStatus NodeStatus_MAX =
+  static constexpr NodeStatus NodeStatus_MAX =
     Node_NodeStatus_NodeStatus_MAX;
-  static const int NodeStatus_ARRAYSIZE =
+  static constexpr int NodeStatus_ARRAYSIZE =
     Node_NodeStatus_NodeStatus_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   NodeStatus_descriptor() {
     return Node_NodeStatus_descriptor();
   }
-  static inline const ::std::string& NodeStatus_Name(NodeStatus value) {
-    return Node_NodeStatus_Name(value);
+  template<typename T>
+  static inline const std::string& NodeStatus_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, NodeStatus>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function NodeStatus_Name.");
+    return Node_NodeStatus_Name(enum_t_value);
   }
-  static inline bool NodeStatus_Parse(const ::std::string& name,
+  static inline bool NodeStatus_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       NodeStatus* value) {
     return Node_NodeStatus_Parse(name, value);
   }
 
+  typedef Node_Encoding Encoding;
+  static constexpr Encoding PLAIN =
+    Node_Encoding_PLAIN;
+  static constexpr Encoding DELTA =
+    Node_Encoding_DELTA;
+  static inline bool Encoding_IsValid(int value) {
+    return Node_Encoding_IsValid(value);
+  }
+  static constexpr Encoding Encoding_MIN =
+    Node_Encoding_Encoding_MIN;
+  static constexpr Encoding Encoding_MAX =
+    Node_Encoding_Encoding_MAX;
+  static constexpr int Encoding_ARRAYSIZE =
+    Node_Encoding_Encoding_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Encoding_descriptor() {
+    return Node_Encoding_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Encoding_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Encoding>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Encoding_Name.");
+    return Node_Encoding_Name(enum_t_value);
+  }
+  static inline bool Encoding_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Encoding* value) {
+    return Node_Encoding_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kLabelsFieldNumber = 22,
+    kLabelFieldNumber = 10,
+    kSolutionFieldNumber = 12,
+    kNogoodFieldNumber = 13,
+    kInfoFieldNumber = 14,
+    kBatchFieldNumber = 19,
+    kTypeFieldNumber = 1,
+    kSidFieldNumber = 2,
+    kPidFieldNumber = 3,
+    kAltFieldNumber = 4,
+    kKidsFieldNumber = 5,
+    kStatusFieldNumber = 6,
+    kTimeFieldNumber = 8,
+    kRestartIdFieldNumber = 7,
+    kThreadIdFieldNumber = 9,
+    kDomainSizeFieldNumber = 11,
+    kNogoodBldFieldNumber = 15,
+    kBackjumpDistanceFieldNumber = 17,
+    kDecisionLevelFieldNumber = 18,
+    kCreditFieldNumber = 20,
+    kUsesAssumptionsFieldNumber = 16,
+    kFlowControlFieldNumber = 21,
+    kFirstLabelIdFieldNumber = 23,
+    kLabelIdFieldNumber = 24,
+    kEncodingFieldNumber = 25,
+  };
+  // repeated string labels = 22;
+  int labels_size() const;
+  private:
+  int _internal_labels_size() const;
+  public:
+  void clear_labels();
+  const std::string& labels(int index) const;
+  std::string* mutable_labels(int index);
+  void set_labels(int index, const std::string& value);
+  void set_labels(int index, std::string&& value);
+  void set_labels(int index, const char* value);
+  void set_labels(int index, const char* value, size_t size);
+  std::string* add_labels();
+  void add_labels(const std::string& value);
+  void add_labels(std::string&& value);
+  void add_labels(const char* value);
+  void add_labels(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& labels() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_labels();
+  private:
+  const std::string& _internal_labels(int index) const;
+  std::string* _internal_add_labels();
+  public:
+
+  // optional string label = 10;
+  bool has_label() const;
+  private:
+  bool _internal_has_label() const;
+  public:
+  void clear_label();
+  const std::string& label() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_label(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_label();
+  PROTOBUF_NODISCARD std::string* release_label();
+  void set_allocated_label(std::string* label);
+  private:
+  const std::string& _internal_label() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_label(const std::string& value);
+  std::string* _internal_mutable_label();
+  public:
+
+  // optional string solution = 12;
+  bool has_solution() const;
+  private:
+  bool _internal_has_solution() const;
+  public:
+  void clear_solution();
+  const std::string& solution() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_solution(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_solution();
+  PROTOBUF_NODISCARD std::string* release_solution();
+  void set_allocated_solution(std::string* solution);
+  private:
+  const std::string& _internal_solution() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_solution(const std::string& value);
+  std::string* _internal_mutable_solution();
+  public:
+
+  // optional string nogood = 13;
+  bool has_nogood() const;
+  private:
+  bool _internal_has_nogood() const;
+  public:
+  void clear_nogood();
+  const std::string& nogood() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nogood(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nogood();
+  PROTOBUF_NODISCARD std::string* release_nogood();
+  void set_allocated_nogood(std::string* nogood);
+  private:
+  const std::string& _internal_nogood() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nogood(const std::string& value);
+  std::string* _internal_mutable_nogood();
+  public:
+
+  // optional string info = 14;
+  bool has_info() const;
+  private:
+  bool _internal_has_info() const;
+  public:
+  void clear_info();
+  const std::string& info() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_info(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_info();
+  PROTOBUF_NODISCARD std::string* release_info();
+  void set_allocated_info(std::string* info);
+  private:
+  const std::string& _internal_info() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_info(const std::string& value);
+  std::string* _internal_mutable_info();
+  public:
+
+  // optional .message.NodeBatch batch = 19;
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
+  public:
+  void clear_batch();
+  const ::message::NodeBatch& batch() const;
+  PROTOBUF_NODISCARD ::message::NodeBatch* release_batch();
+  ::message::NodeBatch* mutable_batch();
+  void set_allocated_batch(::message::NodeBatch* batch);
+  private:
+  const ::message::NodeBatch& _internal_batch() const;
+  ::message::NodeBatch* _internal_mutable_batch();
+  public:
+  void unsafe_arena_set_allocated_batch(
+      ::message::NodeBatch* batch);
+  ::message::NodeBatch* unsafe_arena_release_batch();
+
   // required .message.Node.MsgType type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::message::Node_MsgType type() const;
-  inline void set_type(::message::Node_MsgType value);
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::message::Node_MsgType type() const;
+  void set_type(::message::Node_MsgType value);
+  private:
+  ::message::Node_MsgType _internal_type() const;
+  void _internal_set_type(::message::Node_MsgType value);
+  public:
 
   // optional int32 sid = 2;
-  inline bool has_sid() const;
-  inline void clear_sid();
-  static const int kSidFieldNumber = 2;
-  inline ::google::protobuf::int32 sid() const;
-  inline void set_sid(::google::protobuf::int32 value);
+  bool has_sid() const;
+  private:
+  bool _internal_has_sid() const;
+  public:
+  void clear_sid();
+  int32_t sid() const;
+  void set_sid(int32_t value);
+  private:
+  int32_t _internal_sid() const;
+  void _internal_set_sid(int32_t value);
+  public:
 
   // optional int32 pid = 3;
-  inline bool has_pid() const;
-  inline void clear_pid();
-  static const int kPidFieldNumber = 3;
-  inline ::google::protobuf::int32 pid() const;
-  inline void set_pid(::google::protobuf::int32 value);
+  bool has_pid() const;
+  private:
+  bool _internal_has_pid() const;
+  public:
+  void clear_pid();
+  int32_t pid() const;
+  void set_pid(int32_t value);
+  private:
+  int32_t _internal_pid() const;
+  void _internal_set_pid(int32_t value);
+  public:
 
   // optional int32 alt = 4;
-  inline bool has_alt() const;
-  inline void clear_alt();
-  static const int kAltFieldNumber = 4;
-  inline ::google::protobuf::int32 alt() const;
-  inline void set_alt(::google::protobuf::int32 value);
+  bool has_alt() const;
+  private:
+  bool _internal_has_alt() const;
+  public:
+  void clear_alt();
+  int32_t alt() const;
+  void set_alt(int32_t value);
+  private:
+  int32_t _internal_alt() const;
+  void _internal_set_alt(int32_t value);
+  public:
 
   // optional int32 kids = 5;
-  inline bool has_kids() const;
-  inline void clear_kids();
-  static const int kKidsFieldNumber = 5;
-  inline ::google::protobuf::int32 kids() const;
-  inline void set_kids(::google::protobuf::int32 value);
+  bool has_kids() const;
+  private:
+  bool _internal_has_kids() const;
+  public:
+  void clear_kids();
+  int32_t kids() const;
+  void set_kids(int32_t value);
+  private:
+  int32_t _internal_kids() const;
+  void _internal_set_kids(int32_t value);
+  public:
 
   // optional .message.Node.NodeStatus status = 6;
-  inline bool has_status() const;
-  inline void clear_status();
-  static const int kStatusFieldNumber = 6;
-  inline ::message::Node_NodeStatus status() const;
-  inline void set_status(::message::Node_NodeStatus value);
-
-  // optional int32 restart_id = 7;
-  inline bool has_restart_id() const;
-  inline void clear_restart_id();
-  static const int kRestartIdFieldNumber = 7;
-  inline ::google::protobuf::int32 restart_id() const;
-  inline void set_restart_id(::google::protobuf::int32 value);
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  ::message::Node_NodeStatus status() const;
+  void set_status(::message::Node_NodeStatus value);
+  private:
+  ::message::Node_NodeStatus _internal_status() const;
+  void _internal_set_status(::message::Node_NodeStatus value);
+  public:
 
   // optional uint64 time = 8;
-  inline bool has_time() const;
-  inline void clear_time();
-  static const int kTimeFieldNumber = 8;
-  inline ::google::protobuf::uint64 time() const;
-  inline void set_time(::google::protobuf::uint64 value);
+  bool has_time() const;
+  private:
+  bool _internal_has_time() const;
+  public:
+  void clear_time();
+  uint64_t time() const;
+  void set_time(uint64_t value);
+  private:
+  uint64_t _internal_time() const;
+  void _internal_set_time(uint64_t value);
+  public:
 
-  // optional int32 thread_id = 9;
-  inline bool has_thread_id() const;
-  inline void clear_thread_id();
-  static const int kThreadIdFieldNumber = 9;
-  inline ::google::protobuf::int32 thread_id() const;
-  inline void set_thread_id(::google::protobuf::int32 value);
+  // optional int32 restart_id = 7;
+  bool has_restart_id() const;
+  private:
+  bool _internal_has_restart_id() const;
+  public:
+  void clear_restart_id();
+  int32_t restart_id() const;
+  void set_restart_id(int32_t value);
+  private:
+  int32_t _internal_restart_id() const;
+  void _internal_set_restart_id(int32_t value);
+  public:
 
-  // optional string label = 10;
-  inline bool has_label() const;
-  inline void clear_label();
-  static const int kLabelFieldNumber = 10;
-  inline const ::std::string& label() const;
-  inline void set_label(const ::std::string& value);
-  inline void set_label(const char* value);
-  inline void set_label(const char* value, size_t size);
-  inline ::std::string* mutable_label();
-  inline ::std::string* release_label();
-  inline void set_allocated_label(::std::string* label);
+  // optional int32 thread_id = 9;
+  bool has_thread_id() const;
+  private:
+  bool _internal_has_thread_id() const;
+  public:
+  void clear_thread_id();
+  int32_t thread_id() const;
+  void set_thread_id(int32_t value);
+  private:
+  int32_t _internal_thread_id() const;
+  void _internal_set_thread_id(int32_t value);
+  public:
 
   // optional float domain_size = 11;
-  inline bool has_domain_size() const;
-  inline void clear_domain_size();
-  static const int kDomainSizeFieldNumber = 11;
-  inline float domain_size() const;
-  inline void set_domain_size(float value);
+  bool has_domain_size() const;
+  private:
+  bool _internal_has_domain_size() const;
+  public:
+  void clear_domain_size();
+  float domain_size() const;
+  void set_domain_size(float value);
+  private:
+  float _internal_domain_size() const;
+  void _internal_set_domain_size(float value);
+  public:
 
-  // optional string solution = 12;
-  inline bool has_solution() const;
-  inline void clear_solution();
-  static const int kSolutionFieldNumber = 12;
-  inline const ::std::string& solution() const;
-  inline void set_solution(const ::std::string& value);
-  inline void set_solution(const char* value);
-  inline void set_solution(const char* value, size_t size);
-  inline ::std::string* mutable_solution();
-  inline ::std::string* release_solution();
-  inline void set_allocated_solution(::std::string* solution);
+  // optional int32 nogood_bld = 15;
+  bool has_nogood_bld() const;
+  private:
+  bool _internal_has_nogood_bld() const;
+  public:
+  void clear_nogood_bld();
+  int32_t nogood_bld() const;
+  void set_nogood_bld(int32_t value);
+  private:
+  int32_t _internal_nogood_bld() const;
+  void _internal_set_nogood_bld(int32_t value);
+  public:
 
-  // optional string nogood = 13;
-  inline bool has_nogood() const;
-  inline void clear_nogood();
-  static const int kNogoodFieldNumber = 13;
-  inline const ::std::string& nogood() const;
-  inline void set_nogood(const ::std::string& value);
-  inline void set_nogood(const char* value);
-  inline void set_nogood(const char* value, size_t size);
-  inline ::std::string* mutable_nogood();
-  inline ::std::string* release_nogood();
-  inline void set_allocated_nogood(::std::string* nogood);
+  // optional int32 backjump_distance = 17;
+  bool has_backjump_distance() const;
+  private:
+  bool _internal_has_backjump_distance() const;
+  public:
+  void clear_backjump_distance();
+  int32_t backjump_distance() const;
+  void set_backjump_distance(int32_t value);
+  private:
+  int32_t _internal_backjump_distance() const;
+  void _internal_set_backjump_distance(int32_t value);
+  public:
 
-  // optional string info = 14;
-  inline bool has_info() const;
-  inline void clear_info();
-  static const int kInfoFieldNumber = 14;
-  inline const ::std::string& info() const;
-  inline void set_info(const ::std::string& value);
-  inline void set_info(const char* value);
-  inline void set_info(const char* value, size_t size);
-  inline ::std::string* mutable_info();
-  inline ::std::string* release_info();
-  inline void set_allocated_info(::std::string* info);
+  // optional int32 decision_level = 18;
+  bool has_decision_level() const;
+  private:
+  bool _internal_has_decision_level() const;
+  public:
+  void clear_decision_level();
+  int32_t decision_level() const;
+  void set_decision_level(int32_t value);
+  private:
+  int32_t _internal_decision_level() const;
+  void _internal_set_decision_level(int32_t value);
+  public:
 
-  // optional int32 nogood_bld = 15;
-  inline bool has_nogood_bld() const;
-  inline void clear_nogood_bld();
-  static const int kNogoodBldFieldNumber = 15;
-  inline ::google::protobuf::int32 nogood_bld() const;
-  inline void set_nogood_bld(::google::protobuf::int32 value);
+  // optional int64 credit = 20;
+  bool has_credit() const;
+  private:
+  bool _internal_has_credit() const;
+  public:
+  void clear_credit();
+  int64_t credit() const;
+  void set_credit(int64_t value);
+  private:
+  int64_t _internal_credit() const;
+  void _internal_set_credit(int64_t value);
+  public:
 
   // optional bool uses_assumptions = 16;
-  inline bool has_uses_assumptions() const;
-  inline void clear_uses_assumptions();
-  static const int kUsesAssumptionsFieldNumber = 16;
-  inline bool uses_assumptions() const;
-  inline void set_uses_assumptions(bool value);
+  bool has_uses_assumptions() const;
+  private:
+  bool _internal_has_uses_assumptions() const;
+  public:
+  void clear_uses_assumptions();
+  bool uses_assumptions() const;
+  void set_uses_assumptions(bool value);
+  private:
+  bool _internal_uses_assumptions() const;
+  void _internal_set_uses_assumptions(bool value);
+  public:
 
-  // optional int32 backjump_distance = 17;
-  inline bool has_backjump_distance() const;
-  inline void clear_backjump_distance();
-  static const int kBackjumpDistanceFieldNumber = 17;
-  inline ::google::protobuf::int32 backjump_distance() const;
-  inline void set_backjump_distance(::google::protobuf::int32 value);
+  // optional bool flow_control = 21;
+  bool has_flow_control() const;
+  private:
+  bool _internal_has_flow_control() const;
+  public:
+  void clear_flow_control();
+  bool flow_control() const;
+  void set_flow_control(bool value);
+  private:
+  bool _internal_flow_control() const;
+  void _internal_set_flow_control(bool value);
+  public:
 
-  // optional int32 decision_level = 18;
-  inline bool has_decision_level() const;
-  inline void clear_decision_level();
-  static const int kDecisionLevelFieldNumber = 18;
-  inline ::google::protobuf::int32 decision_level() const;
-  inline void set_decision_level(::google::protobuf::int32 value);
+  // optional int32 first_label_id = 23;
+  bool has_first_label_id() const;
+  private:
+  bool _internal_has_first_label_id() const;
+  public:
+  void clear_first_label_id();
+  int32_t first_label_id() const;
+  void set_first_label_id(int32_t value);
+  private:
+  int32_t _internal_first_label_id() const;
+  void _internal_set_first_label_id(int32_t value);
+  public:
+
+  // optional int32 label_id = 24;
+  bool has_label_id() const;
+  private:
+  bool _internal_has_label_id() const;
+  public:
+  void clear_label_id();
+  int32_t label_id() const;
+  void set_label_id(int32_t value);
+  private:
+  int32_t _internal_label_id() const;
+  void _internal_set_label_id(int32_t value);
+  public:
+
+  // optional .message.Node.Encoding encoding = 25;
+  bool has_encoding() const;
+  private:
+  bool _internal_has_encoding() const;
+  public:
+  void clear_encoding();
+  ::message::Node_Encoding encoding() const;
+  void set_encoding(::message::Node_Encoding value);
+  private:
+  ::message::Node_Encoding _internal_encoding() const;
+  void _internal_set_encoding(::message::Node_Encoding value);
+  public:
 
   // @@protoc_insertion_point(class_scope:message.Node)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_sid();
-  inline void clear_has_sid();
-  inline void set_has_pid();
-  inline void clear_has_pid();
-  inline void set_has_alt();
-  inline void clear_has_alt();
-  inline void set_has_kids();
-  inline void clear_has_kids();
-  inline void set_has_status();
-  inline void clear_has_status();
-  inline void set_has_restart_id();
-  inline void clear_has_restart_id();
-  inline void set_has_time();
-  inline void clear_has_time();
-  inline void set_has_thread_id();
-  inline void clear_has_thread_id();
-  inline void set_has_label();
-  inline void clear_has_label();
-  inline void set_has_domain_size();
-  inline void clear_has_domain_size();
-  inline void set_has_solution();
-  inline void clear_has_solution();
-  inline void set_has_nogood();
-  inline void clear_has_nogood();
-  inline void set_has_info();
-  inline void clear_has_info();
-  inline void set_has_nogood_bld();
-  inline void clear_has_nogood_bld();
-  inline void set_has_uses_assumptions();
-  inline void clear_has_uses_assumptions();
-  inline void set_has_backjump_distance();
-  inline void clear_has_backjump_distance();
-  inline void set_has_decision_level();
-  inline void clear_has_decision_level();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  int type_;
-  ::google::protobuf::int32 sid_;
-  ::google::protobuf::int32 pid_;
-  ::google::protobuf::int32 alt_;
-  ::google::protobuf::int32 kids_;
-  int status_;
-  ::google::protobuf::uint64 time_;
-  ::google::protobuf::int32 restart_id_;
-  ::google::protobuf::int32 thread_id_;
-  ::std::string* label_;
-  ::std::string* solution_;
-  ::std::string* nogood_;
-  float domain_size_;
-  ::google::protobuf::int32 nogood_bld_;
-  ::std::string* info_;
-  bool uses_assumptions_;
-  ::google::protobuf::int32 backjump_distance_;
-  ::google::protobuf::int32 decision_level_;
-  friend void  protobuf_AddDesc_message_2eproto();
-  friend void protobuf_AssignDesc_message_2eproto();
-  friend void protobuf_ShutdownFile_message_2eproto();
-
-  void InitAsDefaultInstance();
-  static Node* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> labels_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr label_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr solution_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nogood_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr info_;
+    ::message::NodeBatch* batch_;
+    int type_;
+    int32_t sid_;
+    int32_t pid_;
+    int32_t alt_;
+    int32_t kids_;
+    int status_;
+    uint64_t time_;
+    int32_t restart_id_;
+    int32_t thread_id_;
+    float domain_size_;
+    int32_t nogood_bld_;
+    int32_t backjump_distance_;
+    int32_t decision_level_;
+    int64_t credit_;
+    bool uses_assumptions_;
+    bool flow_control_;
+    int32_t first_label_id_;
+    int32_t label_id_;
+    int encoding_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class NodeBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.NodeBatch) */ {
+ public:
+  inline NodeBatch() : NodeBatch(nullptr) {}
+  ~NodeBatch() override;
+  explicit PROTOBUF_CONSTEXPR NodeBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NodeBatch(const NodeBatch& from);
+  NodeBatch(NodeBatch&& from) noexcept
+    : NodeBatch() {
+    *this = ::std::move(from);
+  }
 
-// ===================================================================
+  inline NodeBatch& operator=(const NodeBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NodeBatch& operator=(NodeBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// Node
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
 
-// required .message.Node.MsgType type = 1;
-inline bool Node::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NodeBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NodeBatch* internal_default_instance() {
+    return reinterpret_cast<const NodeBatch*>(
+               &_NodeBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(NodeBatch& a, NodeBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NodeBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NodeBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NodeBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NodeBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NodeBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NodeBatch& from) {
+    NodeBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NodeBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.NodeBatch";
+  }
+  protected:
+  explicit NodeBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSidFieldNumber = 1,
+    kPidFieldNumber = 2,
+    kAltFieldNumber = 3,
+    kKidsFieldNumber = 4,
+    kStatusFieldNumber = 5,
+    kRestartIdFieldNumber = 6,
+    kTimeFieldNumber = 7,
+    kThreadIdFieldNumber = 8,
+    kLabelFieldNumber = 9,
+    kLabelTableFieldNumber = 10,
+    kDomainSizeFieldNumber = 11,
+    kDecisionLevelFieldNumber = 12,
+    kNogoodIdxFieldNumber = 13,
+    kNogoodFieldNumber = 14,
+    kInfoIdxFieldNumber = 15,
+    kInfoFieldNumber = 16,
+    kLabelIdFieldNumber = 17,
+    kSidDeltaFieldNumber = 18,
+    kPidDeltaFieldNumber = 19,
+    kTimeDeltaFieldNumber = 20,
+    kNogoodBldFieldNumber = 21,
+    kUsesAssumptionsFieldNumber = 22,
+    kBackjumpDistanceFieldNumber = 23,
+  };
+  // repeated int32 sid = 1 [packed = true];
+  int sid_size() const;
+  private:
+  int _internal_sid_size() const;
+  public:
+  void clear_sid();
+  private:
+  int32_t _internal_sid(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_sid() const;
+  void _internal_add_sid(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_sid();
+  public:
+  int32_t sid(int index) const;
+  void set_sid(int index, int32_t value);
+  void add_sid(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      sid() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_sid();
+
+  // repeated int32 pid = 2 [packed = true];
+  int pid_size() const;
+  private:
+  int _internal_pid_size() const;
+  public:
+  void clear_pid();
+  private:
+  int32_t _internal_pid(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_pid() const;
+  void _internal_add_pid(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_pid();
+  public:
+  int32_t pid(int index) const;
+  void set_pid(int index, int32_t value);
+  void add_pid(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      pid() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_pid();
+
+  // repeated int32 alt = 3 [packed = true];
+  int alt_size() const;
+  private:
+  int _internal_alt_size() const;
+  public:
+  void clear_alt();
+  private:
+  int32_t _internal_alt(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_alt() const;
+  void _internal_add_alt(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_alt();
+  public:
+  int32_t alt(int index) const;
+  void set_alt(int index, int32_t value);
+  void add_alt(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      alt() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_alt();
+
+  // repeated int32 kids = 4 [packed = true];
+  int kids_size() const;
+  private:
+  int _internal_kids_size() const;
+  public:
+  void clear_kids();
+  private:
+  int32_t _internal_kids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_kids() const;
+  void _internal_add_kids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_kids();
+  public:
+  int32_t kids(int index) const;
+  void set_kids(int index, int32_t value);
+  void add_kids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      kids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_kids();
+
+  // repeated int32 status = 5 [packed = true];
+  int status_size() const;
+  private:
+  int _internal_status_size() const;
+  public:
+  void clear_status();
+  private:
+  int32_t _internal_status(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_status() const;
+  void _internal_add_status(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_status();
+  public:
+  int32_t status(int index) const;
+  void set_status(int index, int32_t value);
+  void add_status(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      status() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_status();
+
+  // repeated int32 restart_id = 6 [packed = true];
+  int restart_id_size() const;
+  private:
+  int _internal_restart_id_size() const;
+  public:
+  void clear_restart_id();
+  private:
+  int32_t _internal_restart_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_restart_id() const;
+  void _internal_add_restart_id(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_restart_id();
+  public:
+  int32_t restart_id(int index) const;
+  void set_restart_id(int index, int32_t value);
+  void add_restart_id(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      restart_id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_restart_id();
+
+  // repeated uint64 time = 7 [packed = true];
+  int time_size() const;
+  private:
+  int _internal_time_size() const;
+  public:
+  void clear_time();
+  private:
+  uint64_t _internal_time(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_time() const;
+  void _internal_add_time(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_time();
+  public:
+  uint64_t time(int index) const;
+  void set_time(int index, uint64_t value);
+  void add_time(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      time() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_time();
+
+  // repeated int32 thread_id = 8 [packed = true];
+  int thread_id_size() const;
+  private:
+  int _internal_thread_id_size() const;
+  public:
+  void clear_thread_id();
+  private:
+  int32_t _internal_thread_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_thread_id() const;
+  void _internal_add_thread_id(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_thread_id();
+  public:
+  int32_t thread_id(int index) const;
+  void set_thread_id(int index, int32_t value);
+  void add_thread_id(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      thread_id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_thread_id();
+
+  // repeated int32 label = 9 [packed = true];
+  int label_size() const;
+  private:
+  int _internal_label_size() const;
+  public:
+  void clear_label();
+  private:
+  int32_t _internal_label(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_label() const;
+  void _internal_add_label(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_label();
+  public:
+  int32_t label(int index) const;
+  void set_label(int index, int32_t value);
+  void add_label(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      label() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_label();
+
+  // repeated string label_table = 10;
+  int label_table_size() const;
+  private:
+  int _internal_label_table_size() const;
+  public:
+  void clear_label_table();
+  const std::string& label_table(int index) const;
+  std::string* mutable_label_table(int index);
+  void set_label_table(int index, const std::string& value);
+  void set_label_table(int index, std::string&& value);
+  void set_label_table(int index, const char* value);
+  void set_label_table(int index, const char* value, size_t size);
+  std::string* add_label_table();
+  void add_label_table(const std::string& value);
+  void add_label_table(std::string&& value);
+  void add_label_table(const char* value);
+  void add_label_table(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& label_table() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_label_table();
+  private:
+  const std::string& _internal_label_table(int index) const;
+  std::string* _internal_add_label_table();
+  public:
+
+  // repeated float domain_size = 11 [packed = true];
+  int domain_size_size() const;
+  private:
+  int _internal_domain_size_size() const;
+  public:
+  void clear_domain_size();
+  private:
+  float _internal_domain_size(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_domain_size() const;
+  void _internal_add_domain_size(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_domain_size();
+  public:
+  float domain_size(int index) const;
+  void set_domain_size(int index, float value);
+  void add_domain_size(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      domain_size() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_domain_size();
+
+  // repeated int32 decision_level = 12 [packed = true];
+  int decision_level_size() const;
+  private:
+  int _internal_decision_level_size() const;
+  public:
+  void clear_decision_level();
+  private:
+  int32_t _internal_decision_level(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_decision_level() const;
+  void _internal_add_decision_level(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_decision_level();
+  public:
+  int32_t decision_level(int index) const;
+  void set_decision_level(int index, int32_t value);
+  void add_decision_level(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      decision_level() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_decision_level();
+
+  // repeated int32 nogood_idx = 13 [packed = true];
+  int nogood_idx_size() const;
+  private:
+  int _internal_nogood_idx_size() const;
+  public:
+  void clear_nogood_idx();
+  private:
+  int32_t _internal_nogood_idx(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_nogood_idx() const;
+  void _internal_add_nogood_idx(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_nogood_idx();
+  public:
+  int32_t nogood_idx(int index) const;
+  void set_nogood_idx(int index, int32_t value);
+  void add_nogood_idx(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      nogood_idx() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_nogood_idx();
+
+  // repeated string nogood = 14;
+  int nogood_size() const;
+  private:
+  int _internal_nogood_size() const;
+  public:
+  void clear_nogood();
+  const std::string& nogood(int index) const;
+  std::string* mutable_nogood(int index);
+  void set_nogood(int index, const std::string& value);
+  void set_nogood(int index, std::string&& value);
+  void set_nogood(int index, const char* value);
+  void set_nogood(int index, const char* value, size_t size);
+  std::string* add_nogood();
+  void add_nogood(const std::string& value);
+  void add_nogood(std::string&& value);
+  void add_nogood(const char* value);
+  void add_nogood(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& nogood() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_nogood();
+  private:
+  const std::string& _internal_nogood(int index) const;
+  std::string* _internal_add_nogood();
+  public:
+
+  // repeated int32 info_idx = 15 [packed = true];
+  int info_idx_size() const;
+  private:
+  int _internal_info_idx_size() const;
+  public:
+  void clear_info_idx();
+  private:
+  int32_t _internal_info_idx(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_info_idx() const;
+  void _internal_add_info_idx(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_info_idx();
+  public:
+  int32_t info_idx(int index) const;
+  void set_info_idx(int index, int32_t value);
+  void add_info_idx(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      info_idx() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_info_idx();
+
+  // repeated string info = 16;
+  int info_size() const;
+  private:
+  int _internal_info_size() const;
+  public:
+  void clear_info();
+  const std::string& info(int index) const;
+  std::string* mutable_info(int index);
+  void set_info(int index, const std::string& value);
+  void set_info(int index, std::string&& value);
+  void set_info(int index, const char* value);
+  void set_info(int index, const char* value, size_t size);
+  std::string* add_info();
+  void add_info(const std::string& value);
+  void add_info(std::string&& value);
+  void add_info(const char* value);
+  void add_info(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& info() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_info();
+  private:
+  const std::string& _internal_info(int index) const;
+  std::string* _internal_add_info();
+  public:
+
+  // repeated int32 label_id = 17 [packed = true];
+  int label_id_size() const;
+  private:
+  int _internal_label_id_size() const;
+  public:
+  void clear_label_id();
+  private:
+  int32_t _internal_label_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_label_id() const;
+  void _internal_add_label_id(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_label_id();
+  public:
+  int32_t label_id(int index) const;
+  void set_label_id(int index, int32_t value);
+  void add_label_id(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      label_id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_label_id();
+
+  // repeated sint32 sid_delta = 18 [packed = true];
+  int sid_delta_size() const;
+  private:
+  int _internal_sid_delta_size() const;
+  public:
+  void clear_sid_delta();
+  private:
+  int32_t _internal_sid_delta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_sid_delta() const;
+  void _internal_add_sid_delta(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_sid_delta();
+  public:
+  int32_t sid_delta(int index) const;
+  void set_sid_delta(int index, int32_t value);
+  void add_sid_delta(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      sid_delta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_sid_delta();
+
+  // repeated sint32 pid_delta = 19 [packed = true];
+  int pid_delta_size() const;
+  private:
+  int _internal_pid_delta_size() const;
+  public:
+  void clear_pid_delta();
+  private:
+  int32_t _internal_pid_delta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_pid_delta() const;
+  void _internal_add_pid_delta(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_pid_delta();
+  public:
+  int32_t pid_delta(int index) const;
+  void set_pid_delta(int index, int32_t value);
+  void add_pid_delta(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      pid_delta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_pid_delta();
+
+  // repeated sint64 time_delta = 20 [packed = true];
+  int time_delta_size() const;
+  private:
+  int _internal_time_delta_size() const;
+  public:
+  void clear_time_delta();
+  private:
+  int64_t _internal_time_delta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_time_delta() const;
+  void _internal_add_time_delta(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_time_delta();
+  public:
+  int64_t time_delta(int index) const;
+  void set_time_delta(int index, int64_t value);
+  void add_time_delta(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      time_delta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_time_delta();
+
+  // repeated int32 nogood_bld = 21 [packed = true];
+  int nogood_bld_size() const;
+  private:
+  int _internal_nogood_bld_size() const;
+  public:
+  void clear_nogood_bld();
+  private:
+  int32_t _internal_nogood_bld(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_nogood_bld() const;
+  void _internal_add_nogood_bld(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_nogood_bld();
+  public:
+  int32_t nogood_bld(int index) const;
+  void set_nogood_bld(int index, int32_t value);
+  void add_nogood_bld(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      nogood_bld() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_nogood_bld();
+
+  // repeated bool uses_assumptions = 22 [packed = true];
+  int uses_assumptions_size() const;
+  private:
+  int _internal_uses_assumptions_size() const;
+  public:
+  void clear_uses_assumptions();
+  private:
+  bool _internal_uses_assumptions(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_uses_assumptions() const;
+  void _internal_add_uses_assumptions(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_uses_assumptions();
+  public:
+  bool uses_assumptions(int index) const;
+  void set_uses_assumptions(int index, bool value);
+  void add_uses_assumptions(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      uses_assumptions() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_uses_assumptions();
+
+  // repeated int32 backjump_distance = 23 [packed = true];
+  int backjump_distance_size() const;
+  private:
+  int _internal_backjump_distance_size() const;
+  public:
+  void clear_backjump_distance();
+  private:
+  int32_t _internal_backjump_distance(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_backjump_distance() const;
+  void _internal_add_backjump_distance(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_backjump_distance();
+  public:
+  int32_t backjump_distance(int index) const;
+  void set_backjump_distance(int index, int32_t value);
+  void add_backjump_distance(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      backjump_distance() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_backjump_distance();
+
+  // @@protoc_insertion_point(class_scope:message.NodeBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > sid_;
+    mutable std::atomic<int> _sid_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > pid_;
+    mutable std::atomic<int> _pid_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > alt_;
+    mutable std::atomic<int> _alt_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > kids_;
+    mutable std::atomic<int> _kids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > status_;
+    mutable std::atomic<int> _status_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > restart_id_;
+    mutable std::atomic<int> _restart_id_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > time_;
+    mutable std::atomic<int> _time_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > thread_id_;
+    mutable std::atomic<int> _thread_id_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > label_;
+    mutable std::atomic<int> _label_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> label_table_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > domain_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > decision_level_;
+    mutable std::atomic<int> _decision_level_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > nogood_idx_;
+    mutable std::atomic<int> _nogood_idx_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> nogood_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > info_idx_;
+    mutable std::atomic<int> _info_idx_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > label_id_;
+    mutable std::atomic<int> _label_id_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > sid_delta_;
+    mutable std::atomic<int> _sid_delta_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > pid_delta_;
+    mutable std::atomic<int> _pid_delta_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > time_delta_;
+    mutable std::atomic<int> _time_delta_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > nogood_bld_;
+    mutable std::atomic<int> _nogood_bld_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > uses_assumptions_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > backjump_distance_;
+    mutable std::atomic<int> _backjump_distance_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Node
+
+// required .message.Node.MsgType type = 1;
+inline bool Node::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Node::has_type() const {
+  return _internal_has_type();
+}
+inline void Node::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::message::Node_MsgType Node::_internal_type() const {
+  return static_cast< ::message::Node_MsgType >(_impl_.type_);
+}
+inline ::message::Node_MsgType Node::type() const {
+  // @@protoc_insertion_point(field_get:message.Node.type)
+  return _internal_type();
+}
+inline void Node::_internal_set_type(::message::Node_MsgType value) {
+  assert(::message::Node_MsgType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.type_ = value;
+}
+inline void Node::set_type(::message::Node_MsgType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:message.Node.type)
+}
+
+// optional int32 sid = 2;
+inline bool Node::_internal_has_sid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Node::has_sid() const {
+  return _internal_has_sid();
+}
+inline void Node::clear_sid() {
+  _impl_.sid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t Node::_internal_sid() const {
+  return _impl_.sid_;
+}
+inline int32_t Node::sid() const {
+  // @@protoc_insertion_point(field_get:message.Node.sid)
+  return _internal_sid();
+}
+inline void Node::_internal_set_sid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.sid_ = value;
+}
+inline void Node::set_sid(int32_t value) {
+  _internal_set_sid(value);
+  // @@protoc_insertion_point(field_set:message.Node.sid)
+}
+
+// optional int32 pid = 3;
+inline bool Node::_internal_has_pid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Node::has_pid() const {
+  return _internal_has_pid();
+}
+inline void Node::clear_pid() {
+  _impl_.pid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t Node::_internal_pid() const {
+  return _impl_.pid_;
+}
+inline int32_t Node::pid() const {
+  // @@protoc_insertion_point(field_get:message.Node.pid)
+  return _internal_pid();
+}
+inline void Node::_internal_set_pid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.pid_ = value;
+}
+inline void Node::set_pid(int32_t value) {
+  _internal_set_pid(value);
+  // @@protoc_insertion_point(field_set:message.Node.pid)
+}
+
+// optional int32 alt = 4;
+inline bool Node::_internal_has_alt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Node::has_alt() const {
+  return _internal_has_alt();
+}
+inline void Node::clear_alt() {
+  _impl_.alt_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t Node::_internal_alt() const {
+  return _impl_.alt_;
+}
+inline int32_t Node::alt() const {
+  // @@protoc_insertion_point(field_get:message.Node.alt)
+  return _internal_alt();
+}
+inline void Node::_internal_set_alt(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.alt_ = value;
+}
+inline void Node::set_alt(int32_t value) {
+  _internal_set_alt(value);
+  // @@protoc_insertion_point(field_set:message.Node.alt)
+}
+
+// optional int32 kids = 5;
+inline bool Node::_internal_has_kids() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Node::has_kids() const {
+  return _internal_has_kids();
+}
+inline void Node::clear_kids() {
+  _impl_.kids_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline int32_t Node::_internal_kids() const {
+  return _impl_.kids_;
+}
+inline int32_t Node::kids() const {
+  // @@protoc_insertion_point(field_get:message.Node.kids)
+  return _internal_kids();
+}
+inline void Node::_internal_set_kids(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.kids_ = value;
+}
+inline void Node::set_kids(int32_t value) {
+  _internal_set_kids(value);
+  // @@protoc_insertion_point(field_set:message.Node.kids)
+}
+
+// optional .message.Node.NodeStatus status = 6;
+inline bool Node::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Node::has_status() const {
+  return _internal_has_status();
+}
+inline void Node::clear_status() {
+  _impl_.status_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline ::message::Node_NodeStatus Node::_internal_status() const {
+  return static_cast< ::message::Node_NodeStatus >(_impl_.status_);
+}
+inline ::message::Node_NodeStatus Node::status() const {
+  // @@protoc_insertion_point(field_get:message.Node.status)
+  return _internal_status();
+}
+inline void Node::_internal_set_status(::message::Node_NodeStatus value) {
+  assert(::message::Node_NodeStatus_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.status_ = value;
+}
+inline void Node::set_status(::message::Node_NodeStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:message.Node.status)
+}
+
+// optional int32 restart_id = 7;
+inline bool Node::_internal_has_restart_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Node::has_restart_id() const {
+  return _internal_has_restart_id();
+}
+inline void Node::clear_restart_id() {
+  _impl_.restart_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline int32_t Node::_internal_restart_id() const {
+  return _impl_.restart_id_;
+}
+inline int32_t Node::restart_id() const {
+  // @@protoc_insertion_point(field_get:message.Node.restart_id)
+  return _internal_restart_id();
+}
+inline void Node::_internal_set_restart_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.restart_id_ = value;
+}
+inline void Node::set_restart_id(int32_t value) {
+  _internal_set_restart_id(value);
+  // @@protoc_insertion_point(field_set:message.Node.restart_id)
+}
+
+// optional uint64 time = 8;
+inline bool Node::_internal_has_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Node::has_time() const {
+  return _internal_has_time();
+}
+inline void Node::clear_time() {
+  _impl_.time_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint64_t Node::_internal_time() const {
+  return _impl_.time_;
+}
+inline uint64_t Node::time() const {
+  // @@protoc_insertion_point(field_get:message.Node.time)
+  return _internal_time();
+}
+inline void Node::_internal_set_time(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.time_ = value;
+}
+inline void Node::set_time(uint64_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:message.Node.time)
+}
+
+// optional int32 thread_id = 9;
+inline bool Node::_internal_has_thread_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Node::has_thread_id() const {
+  return _internal_has_thread_id();
+}
+inline void Node::clear_thread_id() {
+  _impl_.thread_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline int32_t Node::_internal_thread_id() const {
+  return _impl_.thread_id_;
+}
+inline int32_t Node::thread_id() const {
+  // @@protoc_insertion_point(field_get:message.Node.thread_id)
+  return _internal_thread_id();
+}
+inline void Node::_internal_set_thread_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.thread_id_ = value;
+}
+inline void Node::set_thread_id(int32_t value) {
+  _internal_set_thread_id(value);
+  // @@protoc_insertion_point(field_set:message.Node.thread_id)
+}
+
+// optional string label = 10;
+inline bool Node::_internal_has_label() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Node::has_label() const {
+  return _internal_has_label();
+}
+inline void Node::clear_label() {
+  _impl_.label_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Node::label() const {
+  // @@protoc_insertion_point(field_get:message.Node.label)
+  return _internal_label();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Node::set_label(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.label_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.Node.label)
+}
+inline std::string* Node::mutable_label() {
+  std::string* _s = _internal_mutable_label();
+  // @@protoc_insertion_point(field_mutable:message.Node.label)
+  return _s;
+}
+inline const std::string& Node::_internal_label() const {
+  return _impl_.label_.Get();
+}
+inline void Node::_internal_set_label(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.label_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Node::_internal_mutable_label() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.label_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Node::release_label() {
+  // @@protoc_insertion_point(field_release:message.Node.label)
+  if (!_internal_has_label()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.label_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.label_.IsDefault()) {
+    _impl_.label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Node::set_allocated_label(std::string* label) {
+  if (label != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.label_.SetAllocated(label, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.label_.IsDefault()) {
+    _impl_.label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.Node.label)
+}
+
+// optional float domain_size = 11;
+inline bool Node::_internal_has_domain_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool Node::has_domain_size() const {
+  return _internal_has_domain_size();
+}
+inline void Node::clear_domain_size() {
+  _impl_.domain_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline float Node::_internal_domain_size() const {
+  return _impl_.domain_size_;
+}
+inline float Node::domain_size() const {
+  // @@protoc_insertion_point(field_get:message.Node.domain_size)
+  return _internal_domain_size();
+}
+inline void Node::_internal_set_domain_size(float value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.domain_size_ = value;
+}
+inline void Node::set_domain_size(float value) {
+  _internal_set_domain_size(value);
+  // @@protoc_insertion_point(field_set:message.Node.domain_size)
+}
+
+// optional string solution = 12;
+inline bool Node::_internal_has_solution() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Node::has_solution() const {
+  return _internal_has_solution();
+}
+inline void Node::clear_solution() {
+  _impl_.solution_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Node::solution() const {
+  // @@protoc_insertion_point(field_get:message.Node.solution)
+  return _internal_solution();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Node::set_solution(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.solution_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.Node.solution)
+}
+inline std::string* Node::mutable_solution() {
+  std::string* _s = _internal_mutable_solution();
+  // @@protoc_insertion_point(field_mutable:message.Node.solution)
+  return _s;
+}
+inline const std::string& Node::_internal_solution() const {
+  return _impl_.solution_.Get();
+}
+inline void Node::_internal_set_solution(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.solution_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Node::_internal_mutable_solution() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.solution_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Node::release_solution() {
+  // @@protoc_insertion_point(field_release:message.Node.solution)
+  if (!_internal_has_solution()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.solution_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.solution_.IsDefault()) {
+    _impl_.solution_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Node::set_allocated_solution(std::string* solution) {
+  if (solution != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.solution_.SetAllocated(solution, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.solution_.IsDefault()) {
+    _impl_.solution_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.Node.solution)
+}
+
+// optional string nogood = 13;
+inline bool Node::_internal_has_nogood() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Node::has_nogood() const {
+  return _internal_has_nogood();
+}
+inline void Node::clear_nogood() {
+  _impl_.nogood_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Node::nogood() const {
+  // @@protoc_insertion_point(field_get:message.Node.nogood)
+  return _internal_nogood();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Node::set_nogood(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.nogood_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.Node.nogood)
+}
+inline std::string* Node::mutable_nogood() {
+  std::string* _s = _internal_mutable_nogood();
+  // @@protoc_insertion_point(field_mutable:message.Node.nogood)
+  return _s;
+}
+inline const std::string& Node::_internal_nogood() const {
+  return _impl_.nogood_.Get();
+}
+inline void Node::_internal_set_nogood(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.nogood_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Node::_internal_mutable_nogood() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.nogood_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Node::release_nogood() {
+  // @@protoc_insertion_point(field_release:message.Node.nogood)
+  if (!_internal_has_nogood()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.nogood_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nogood_.IsDefault()) {
+    _impl_.nogood_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Node::set_allocated_nogood(std::string* nogood) {
+  if (nogood != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.nogood_.SetAllocated(nogood, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nogood_.IsDefault()) {
+    _impl_.nogood_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.Node.nogood)
+}
+
+// optional string info = 14;
+inline bool Node::_internal_has_info() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Node::has_info() const {
+  return _internal_has_info();
+}
+inline void Node::clear_info() {
+  _impl_.info_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& Node::info() const {
+  // @@protoc_insertion_point(field_get:message.Node.info)
+  return _internal_info();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Node::set_info(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.info_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.Node.info)
+}
+inline std::string* Node::mutable_info() {
+  std::string* _s = _internal_mutable_info();
+  // @@protoc_insertion_point(field_mutable:message.Node.info)
+  return _s;
+}
+inline const std::string& Node::_internal_info() const {
+  return _impl_.info_.Get();
+}
+inline void Node::_internal_set_info(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.info_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Node::_internal_mutable_info() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.info_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Node::release_info() {
+  // @@protoc_insertion_point(field_release:message.Node.info)
+  if (!_internal_has_info()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.info_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.info_.IsDefault()) {
+    _impl_.info_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Node::set_allocated_info(std::string* info) {
+  if (info != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.info_.SetAllocated(info, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.info_.IsDefault()) {
+    _impl_.info_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.Node.info)
+}
+
+// optional int32 nogood_bld = 15;
+inline bool Node::_internal_has_nogood_bld() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool Node::has_nogood_bld() const {
+  return _internal_has_nogood_bld();
+}
+inline void Node::clear_nogood_bld() {
+  _impl_.nogood_bld_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline int32_t Node::_internal_nogood_bld() const {
+  return _impl_.nogood_bld_;
+}
+inline int32_t Node::nogood_bld() const {
+  // @@protoc_insertion_point(field_get:message.Node.nogood_bld)
+  return _internal_nogood_bld();
+}
+inline void Node::_internal_set_nogood_bld(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.nogood_bld_ = value;
+}
+inline void Node::set_nogood_bld(int32_t value) {
+  _internal_set_nogood_bld(value);
+  // @@protoc_insertion_point(field_set:message.Node.nogood_bld)
+}
+
+// optional bool uses_assumptions = 16;
+inline bool Node::_internal_has_uses_assumptions() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
+}
+inline bool Node::has_uses_assumptions() const {
+  return _internal_has_uses_assumptions();
+}
+inline void Node::clear_uses_assumptions() {
+  _impl_.uses_assumptions_ = false;
+  _impl_._has_bits_[0] &= ~0x00080000u;
+}
+inline bool Node::_internal_uses_assumptions() const {
+  return _impl_.uses_assumptions_;
+}
+inline bool Node::uses_assumptions() const {
+  // @@protoc_insertion_point(field_get:message.Node.uses_assumptions)
+  return _internal_uses_assumptions();
+}
+inline void Node::_internal_set_uses_assumptions(bool value) {
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.uses_assumptions_ = value;
+}
+inline void Node::set_uses_assumptions(bool value) {
+  _internal_set_uses_assumptions(value);
+  // @@protoc_insertion_point(field_set:message.Node.uses_assumptions)
+}
+
+// optional int32 backjump_distance = 17;
+inline bool Node::_internal_has_backjump_distance() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool Node::has_backjump_distance() const {
+  return _internal_has_backjump_distance();
+}
+inline void Node::clear_backjump_distance() {
+  _impl_.backjump_distance_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline int32_t Node::_internal_backjump_distance() const {
+  return _impl_.backjump_distance_;
+}
+inline int32_t Node::backjump_distance() const {
+  // @@protoc_insertion_point(field_get:message.Node.backjump_distance)
+  return _internal_backjump_distance();
+}
+inline void Node::_internal_set_backjump_distance(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.backjump_distance_ = value;
+}
+inline void Node::set_backjump_distance(int32_t value) {
+  _internal_set_backjump_distance(value);
+  // @@protoc_insertion_point(field_set:message.Node.backjump_distance)
+}
+
+// optional int32 decision_level = 18;
+inline bool Node::_internal_has_decision_level() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool Node::has_decision_level() const {
+  return _internal_has_decision_level();
+}
+inline void Node::clear_decision_level() {
+  _impl_.decision_level_ = 0;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline int32_t Node::_internal_decision_level() const {
+  return _impl_.decision_level_;
+}
+inline int32_t Node::decision_level() const {
+  // @@protoc_insertion_point(field_get:message.Node.decision_level)
+  return _internal_decision_level();
+}
+inline void Node::_internal_set_decision_level(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.decision_level_ = value;
+}
+inline void Node::set_decision_level(int32_t value) {
+  _internal_set_decision_level(value);
+  // @@protoc_insertion_point(field_set:message.Node.decision_level)
+}
+
+// optional .message.NodeBatch batch = 19;
+inline bool Node::_internal_has_batch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.batch_ != nullptr);
+  return value;
+}
+inline bool Node::has_batch() const {
+  return _internal_has_batch();
+}
+inline void Node::clear_batch() {
+  if (_impl_.batch_ != nullptr) _impl_.batch_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::message::NodeBatch& Node::_internal_batch() const {
+  const ::message::NodeBatch* p = _impl_.batch_;
+  return p != nullptr ? *p : reinterpret_cast<const ::message::NodeBatch&>(
+      ::message::_NodeBatch_default_instance_);
+}
+inline const ::message::NodeBatch& Node::batch() const {
+  // @@protoc_insertion_point(field_get:message.Node.batch)
+  return _internal_batch();
+}
+inline void Node::unsafe_arena_set_allocated_batch(
+    ::message::NodeBatch* batch) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.batch_);
+  }
+  _impl_.batch_ = batch;
+  if (batch) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:message.Node.batch)
+}
+inline ::message::NodeBatch* Node::release_batch() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::message::NodeBatch* temp = _impl_.batch_;
+  _impl_.batch_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::message::NodeBatch* Node::unsafe_arena_release_batch() {
+  // @@protoc_insertion_point(field_release:message.Node.batch)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::message::NodeBatch* temp = _impl_.batch_;
+  _impl_.batch_ = nullptr;
+  return temp;
+}
+inline ::message::NodeBatch* Node::_internal_mutable_batch() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.batch_ == nullptr) {
+    auto* p = CreateMaybeMessage<::message::NodeBatch>(GetArenaForAllocation());
+    _impl_.batch_ = p;
+  }
+  return _impl_.batch_;
+}
+inline ::message::NodeBatch* Node::mutable_batch() {
+  ::message::NodeBatch* _msg = _internal_mutable_batch();
+  // @@protoc_insertion_point(field_mutable:message.Node.batch)
+  return _msg;
+}
+inline void Node::set_allocated_batch(::message::NodeBatch* batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.batch_;
+  }
+  if (batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(batch);
+    if (message_arena != submessage_arena) {
+      batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.batch_ = batch;
+  // @@protoc_insertion_point(field_set_allocated:message.Node.batch)
+}
+
+// optional int64 credit = 20;
+inline bool Node::_internal_has_credit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool Node::has_credit() const {
+  return _internal_has_credit();
+}
+inline void Node::clear_credit() {
+  _impl_.credit_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline int64_t Node::_internal_credit() const {
+  return _impl_.credit_;
+}
+inline int64_t Node::credit() const {
+  // @@protoc_insertion_point(field_get:message.Node.credit)
+  return _internal_credit();
+}
+inline void Node::_internal_set_credit(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.credit_ = value;
+}
+inline void Node::set_credit(int64_t value) {
+  _internal_set_credit(value);
+  // @@protoc_insertion_point(field_set:message.Node.credit)
+}
+
+// optional bool flow_control = 21;
+inline bool Node::_internal_has_flow_control() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
+}
+inline bool Node::has_flow_control() const {
+  return _internal_has_flow_control();
+}
+inline void Node::clear_flow_control() {
+  _impl_.flow_control_ = false;
+  _impl_._has_bits_[0] &= ~0x00100000u;
+}
+inline bool Node::_internal_flow_control() const {
+  return _impl_.flow_control_;
+}
+inline bool Node::flow_control() const {
+  // @@protoc_insertion_point(field_get:message.Node.flow_control)
+  return _internal_flow_control();
+}
+inline void Node::_internal_set_flow_control(bool value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.flow_control_ = value;
+}
+inline void Node::set_flow_control(bool value) {
+  _internal_set_flow_control(value);
+  // @@protoc_insertion_point(field_set:message.Node.flow_control)
+}
+
+// repeated string labels = 22;
+inline int Node::_internal_labels_size() const {
+  return _impl_.labels_.size();
+}
+inline int Node::labels_size() const {
+  return _internal_labels_size();
+}
+inline void Node::clear_labels() {
+  _impl_.labels_.Clear();
+}
+inline std::string* Node::add_labels() {
+  std::string* _s = _internal_add_labels();
+  // @@protoc_insertion_point(field_add_mutable:message.Node.labels)
+  return _s;
+}
+inline const std::string& Node::_internal_labels(int index) const {
+  return _impl_.labels_.Get(index);
+}
+inline const std::string& Node::labels(int index) const {
+  // @@protoc_insertion_point(field_get:message.Node.labels)
+  return _internal_labels(index);
+}
+inline std::string* Node::mutable_labels(int index) {
+  // @@protoc_insertion_point(field_mutable:message.Node.labels)
+  return _impl_.labels_.Mutable(index);
+}
+inline void Node::set_labels(int index, const std::string& value) {
+  _impl_.labels_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:message.Node.labels)
+}
+inline void Node::set_labels(int index, std::string&& value) {
+  _impl_.labels_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:message.Node.labels)
+}
+inline void Node::set_labels(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.labels_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:message.Node.labels)
+}
+inline void Node::set_labels(int index, const char* value, size_t size) {
+  _impl_.labels_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:message.Node.labels)
+}
+inline std::string* Node::_internal_add_labels() {
+  return _impl_.labels_.Add();
+}
+inline void Node::add_labels(const std::string& value) {
+  _impl_.labels_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:message.Node.labels)
+}
+inline void Node::add_labels(std::string&& value) {
+  _impl_.labels_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:message.Node.labels)
+}
+inline void Node::add_labels(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.labels_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:message.Node.labels)
+}
+inline void Node::add_labels(const char* value, size_t size) {
+  _impl_.labels_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:message.Node.labels)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Node::labels() const {
+  // @@protoc_insertion_point(field_list:message.Node.labels)
+  return _impl_.labels_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Node::mutable_labels() {
+  // @@protoc_insertion_point(field_mutable_list:message.Node.labels)
+  return &_impl_.labels_;
+}
+
+// optional int32 first_label_id = 23;
+inline bool Node::_internal_has_first_label_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
+}
+inline bool Node::has_first_label_id() const {
+  return _internal_has_first_label_id();
+}
+inline void Node::clear_first_label_id() {
+  _impl_.first_label_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00200000u;
+}
+inline int32_t Node::_internal_first_label_id() const {
+  return _impl_.first_label_id_;
+}
+inline int32_t Node::first_label_id() const {
+  // @@protoc_insertion_point(field_get:message.Node.first_label_id)
+  return _internal_first_label_id();
+}
+inline void Node::_internal_set_first_label_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.first_label_id_ = value;
+}
+inline void Node::set_first_label_id(int32_t value) {
+  _internal_set_first_label_id(value);
+  // @@protoc_insertion_point(field_set:message.Node.first_label_id)
+}
+
+// optional int32 label_id = 24;
+inline bool Node::_internal_has_label_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00400000u) != 0;
+  return value;
+}
+inline bool Node::has_label_id() const {
+  return _internal_has_label_id();
+}
+inline void Node::clear_label_id() {
+  _impl_.label_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00400000u;
+}
+inline int32_t Node::_internal_label_id() const {
+  return _impl_.label_id_;
+}
+inline int32_t Node::label_id() const {
+  // @@protoc_insertion_point(field_get:message.Node.label_id)
+  return _internal_label_id();
+}
+inline void Node::_internal_set_label_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00400000u;
+  _impl_.label_id_ = value;
+}
+inline void Node::set_label_id(int32_t value) {
+  _internal_set_label_id(value);
+  // @@protoc_insertion_point(field_set:message.Node.label_id)
+}
+
+// optional .message.Node.Encoding encoding = 25;
+inline bool Node::_internal_has_encoding() const {
+  bool value = (_impl_._has_bits_[0] & 0x00800000u) != 0;
+  return value;
+}
+inline bool Node::has_encoding() const {
+  return _internal_has_encoding();
+}
+inline void Node::clear_encoding() {
+  _impl_.encoding_ = 0;
+  _impl_._has_bits_[0] &= ~0x00800000u;
+}
+inline ::message::Node_Encoding Node::_internal_encoding() const {
+  return static_cast< ::message::Node_Encoding >(_impl_.encoding_);
+}
+inline ::message::Node_Encoding Node::encoding() const {
+  // @@protoc_insertion_point(field_get:message.Node.encoding)
+  return _internal_encoding();
+}
+inline void Node::_internal_set_encoding(::message::Node_Encoding value) {
+  assert(::message::Node_Encoding_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00800000u;
+  _impl_.encoding_ = value;
+}
+inline void Node::set_encoding(::message::Node_Encoding value) {
+  _internal_set_encoding(value);
+  // @@protoc_insertion_point(field_set:message.Node.encoding)
+}
+
+// -------------------------------------------------------------------
+
+// NodeBatch
+
+// repeated int32 sid = 1 [packed = true];
+inline int NodeBatch::_internal_sid_size() const {
+  return _impl_.sid_.size();
+}
+inline int NodeBatch::sid_size() const {
+  return _internal_sid_size();
+}
+inline void NodeBatch::clear_sid() {
+  _impl_.sid_.Clear();
+}
+inline int32_t NodeBatch::_internal_sid(int index) const {
+  return _impl_.sid_.Get(index);
+}
+inline int32_t NodeBatch::sid(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.sid)
+  return _internal_sid(index);
+}
+inline void NodeBatch::set_sid(int index, int32_t value) {
+  _impl_.sid_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.sid)
+}
+inline void NodeBatch::_internal_add_sid(int32_t value) {
+  _impl_.sid_.Add(value);
+}
+inline void NodeBatch::add_sid(int32_t value) {
+  _internal_add_sid(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.sid)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_sid() const {
+  return _impl_.sid_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::sid() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.sid)
+  return _internal_sid();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_sid() {
+  return &_impl_.sid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_sid() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.sid)
+  return _internal_mutable_sid();
+}
+
+// repeated int32 pid = 2 [packed = true];
+inline int NodeBatch::_internal_pid_size() const {
+  return _impl_.pid_.size();
+}
+inline int NodeBatch::pid_size() const {
+  return _internal_pid_size();
+}
+inline void NodeBatch::clear_pid() {
+  _impl_.pid_.Clear();
+}
+inline int32_t NodeBatch::_internal_pid(int index) const {
+  return _impl_.pid_.Get(index);
+}
+inline int32_t NodeBatch::pid(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.pid)
+  return _internal_pid(index);
+}
+inline void NodeBatch::set_pid(int index, int32_t value) {
+  _impl_.pid_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.pid)
+}
+inline void NodeBatch::_internal_add_pid(int32_t value) {
+  _impl_.pid_.Add(value);
+}
+inline void NodeBatch::add_pid(int32_t value) {
+  _internal_add_pid(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.pid)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_pid() const {
+  return _impl_.pid_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::pid() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.pid)
+  return _internal_pid();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_pid() {
+  return &_impl_.pid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_pid() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.pid)
+  return _internal_mutable_pid();
+}
+
+// repeated int32 alt = 3 [packed = true];
+inline int NodeBatch::_internal_alt_size() const {
+  return _impl_.alt_.size();
+}
+inline int NodeBatch::alt_size() const {
+  return _internal_alt_size();
+}
+inline void NodeBatch::clear_alt() {
+  _impl_.alt_.Clear();
+}
+inline int32_t NodeBatch::_internal_alt(int index) const {
+  return _impl_.alt_.Get(index);
+}
+inline int32_t NodeBatch::alt(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.alt)
+  return _internal_alt(index);
+}
+inline void NodeBatch::set_alt(int index, int32_t value) {
+  _impl_.alt_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.alt)
+}
+inline void NodeBatch::_internal_add_alt(int32_t value) {
+  _impl_.alt_.Add(value);
+}
+inline void NodeBatch::add_alt(int32_t value) {
+  _internal_add_alt(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.alt)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_alt() const {
+  return _impl_.alt_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::alt() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.alt)
+  return _internal_alt();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_alt() {
+  return &_impl_.alt_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_alt() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.alt)
+  return _internal_mutable_alt();
+}
+
+// repeated int32 kids = 4 [packed = true];
+inline int NodeBatch::_internal_kids_size() const {
+  return _impl_.kids_.size();
+}
+inline int NodeBatch::kids_size() const {
+  return _internal_kids_size();
+}
+inline void NodeBatch::clear_kids() {
+  _impl_.kids_.Clear();
+}
+inline int32_t NodeBatch::_internal_kids(int index) const {
+  return _impl_.kids_.Get(index);
+}
+inline int32_t NodeBatch::kids(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.kids)
+  return _internal_kids(index);
+}
+inline void NodeBatch::set_kids(int index, int32_t value) {
+  _impl_.kids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.kids)
+}
+inline void NodeBatch::_internal_add_kids(int32_t value) {
+  _impl_.kids_.Add(value);
+}
+inline void NodeBatch::add_kids(int32_t value) {
+  _internal_add_kids(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.kids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_kids() const {
+  return _impl_.kids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::kids() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.kids)
+  return _internal_kids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_kids() {
+  return &_impl_.kids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_kids() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.kids)
+  return _internal_mutable_kids();
+}
+
+// repeated int32 status = 5 [packed = true];
+inline int NodeBatch::_internal_status_size() const {
+  return _impl_.status_.size();
+}
+inline int NodeBatch::status_size() const {
+  return _internal_status_size();
+}
+inline void NodeBatch::clear_status() {
+  _impl_.status_.Clear();
+}
+inline int32_t NodeBatch::_internal_status(int index) const {
+  return _impl_.status_.Get(index);
+}
+inline int32_t NodeBatch::status(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.status)
+  return _internal_status(index);
+}
+inline void NodeBatch::set_status(int index, int32_t value) {
+  _impl_.status_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.status)
+}
+inline void NodeBatch::_internal_add_status(int32_t value) {
+  _impl_.status_.Add(value);
+}
+inline void NodeBatch::add_status(int32_t value) {
+  _internal_add_status(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.status)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_status() const {
+  return _impl_.status_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::status() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.status)
+  return _internal_status();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_status() {
+  return &_impl_.status_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_status() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.status)
+  return _internal_mutable_status();
+}
+
+// repeated int32 restart_id = 6 [packed = true];
+inline int NodeBatch::_internal_restart_id_size() const {
+  return _impl_.restart_id_.size();
 }
-inline void Node::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
+inline int NodeBatch::restart_id_size() const {
+  return _internal_restart_id_size();
 }
-inline void Node::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void NodeBatch::clear_restart_id() {
+  _impl_.restart_id_.Clear();
 }
-inline void Node::clear_type() {
-  type_ = 0;
-  clear_has_type();
+inline int32_t NodeBatch::_internal_restart_id(int index) const {
+  return _impl_.restart_id_.Get(index);
 }
-inline ::message::Node_MsgType Node::type() const {
-  // @@protoc_insertion_point(field_get:message.Node.type)
-  return static_cast< ::message::Node_MsgType >(type_);
+inline int32_t NodeBatch::restart_id(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.restart_id)
+  return _internal_restart_id(index);
 }
-inline void Node::set_type(::message::Node_MsgType value) {
-  assert(::message::Node_MsgType_IsValid(value));
-  set_has_type();
-  type_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.type)
+inline void NodeBatch::set_restart_id(int index, int32_t value) {
+  _impl_.restart_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.restart_id)
+}
+inline void NodeBatch::_internal_add_restart_id(int32_t value) {
+  _impl_.restart_id_.Add(value);
+}
+inline void NodeBatch::add_restart_id(int32_t value) {
+  _internal_add_restart_id(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.restart_id)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_restart_id() const {
+  return _impl_.restart_id_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::restart_id() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.restart_id)
+  return _internal_restart_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_restart_id() {
+  return &_impl_.restart_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_restart_id() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.restart_id)
+  return _internal_mutable_restart_id();
 }
 
-// optional int32 sid = 2;
-inline bool Node::has_sid() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// repeated uint64 time = 7 [packed = true];
+inline int NodeBatch::_internal_time_size() const {
+  return _impl_.time_.size();
 }
-inline void Node::set_has_sid() {
-  _has_bits_[0] |= 0x00000002u;
+inline int NodeBatch::time_size() const {
+  return _internal_time_size();
 }
-inline void Node::clear_has_sid() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void NodeBatch::clear_time() {
+  _impl_.time_.Clear();
 }
-inline void Node::clear_sid() {
-  sid_ = 0;
-  clear_has_sid();
+inline uint64_t NodeBatch::_internal_time(int index) const {
+  return _impl_.time_.Get(index);
 }
-inline ::google::protobuf::int32 Node::sid() const {
-  // @@protoc_insertion_point(field_get:message.Node.sid)
-  return sid_;
+inline uint64_t NodeBatch::time(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.time)
+  return _internal_time(index);
 }
-inline void Node::set_sid(::google::protobuf::int32 value) {
-  set_has_sid();
-  sid_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.sid)
+inline void NodeBatch::set_time(int index, uint64_t value) {
+  _impl_.time_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.time)
+}
+inline void NodeBatch::_internal_add_time(uint64_t value) {
+  _impl_.time_.Add(value);
+}
+inline void NodeBatch::add_time(uint64_t value) {
+  _internal_add_time(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.time)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+NodeBatch::_internal_time() const {
+  return _impl_.time_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+NodeBatch::time() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.time)
+  return _internal_time();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+NodeBatch::_internal_mutable_time() {
+  return &_impl_.time_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+NodeBatch::mutable_time() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.time)
+  return _internal_mutable_time();
 }
 
-// optional int32 pid = 3;
-inline bool Node::has_pid() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// repeated int32 thread_id = 8 [packed = true];
+inline int NodeBatch::_internal_thread_id_size() const {
+  return _impl_.thread_id_.size();
 }
-inline void Node::set_has_pid() {
-  _has_bits_[0] |= 0x00000004u;
+inline int NodeBatch::thread_id_size() const {
+  return _internal_thread_id_size();
 }
-inline void Node::clear_has_pid() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void NodeBatch::clear_thread_id() {
+  _impl_.thread_id_.Clear();
 }
-inline void Node::clear_pid() {
-  pid_ = 0;
-  clear_has_pid();
+inline int32_t NodeBatch::_internal_thread_id(int index) const {
+  return _impl_.thread_id_.Get(index);
 }
-inline ::google::protobuf::int32 Node::pid() const {
-  // @@protoc_insertion_point(field_get:message.Node.pid)
-  return pid_;
+inline int32_t NodeBatch::thread_id(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.thread_id)
+  return _internal_thread_id(index);
 }
-inline void Node::set_pid(::google::protobuf::int32 value) {
-  set_has_pid();
-  pid_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.pid)
+inline void NodeBatch::set_thread_id(int index, int32_t value) {
+  _impl_.thread_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.thread_id)
+}
+inline void NodeBatch::_internal_add_thread_id(int32_t value) {
+  _impl_.thread_id_.Add(value);
+}
+inline void NodeBatch::add_thread_id(int32_t value) {
+  _internal_add_thread_id(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.thread_id)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_thread_id() const {
+  return _impl_.thread_id_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::thread_id() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.thread_id)
+  return _internal_thread_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_thread_id() {
+  return &_impl_.thread_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_thread_id() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.thread_id)
+  return _internal_mutable_thread_id();
 }
 
-// optional int32 alt = 4;
-inline bool Node::has_alt() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// repeated int32 label = 9 [packed = true];
+inline int NodeBatch::_internal_label_size() const {
+  return _impl_.label_.size();
 }
-inline void Node::set_has_alt() {
-  _has_bits_[0] |= 0x00000008u;
+inline int NodeBatch::label_size() const {
+  return _internal_label_size();
 }
-inline void Node::clear_has_alt() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void NodeBatch::clear_label() {
+  _impl_.label_.Clear();
 }
-inline void Node::clear_alt() {
-  alt_ = 0;
-  clear_has_alt();
+inline int32_t NodeBatch::_internal_label(int index) const {
+  return _impl_.label_.Get(index);
 }
-inline ::google::protobuf::int32 Node::alt() const {
-  // @@protoc_insertion_point(field_get:message.Node.alt)
-  return alt_;
+inline int32_t NodeBatch::label(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.label)
+  return _internal_label(index);
 }
-inline void Node::set_alt(::google::protobuf::int32 value) {
-  set_has_alt();
-  alt_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.alt)
+inline void NodeBatch::set_label(int index, int32_t value) {
+  _impl_.label_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.label)
+}
+inline void NodeBatch::_internal_add_label(int32_t value) {
+  _impl_.label_.Add(value);
+}
+inline void NodeBatch::add_label(int32_t value) {
+  _internal_add_label(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.label)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_label() const {
+  return _impl_.label_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::label() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.label)
+  return _internal_label();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_label() {
+  return &_impl_.label_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_label() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.label)
+  return _internal_mutable_label();
 }
 
-// optional int32 kids = 5;
-inline bool Node::has_kids() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// repeated string label_table = 10;
+inline int NodeBatch::_internal_label_table_size() const {
+  return _impl_.label_table_.size();
 }
-inline void Node::set_has_kids() {
-  _has_bits_[0] |= 0x00000010u;
+inline int NodeBatch::label_table_size() const {
+  return _internal_label_table_size();
 }
-inline void Node::clear_has_kids() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void NodeBatch::clear_label_table() {
+  _impl_.label_table_.Clear();
 }
-inline void Node::clear_kids() {
-  kids_ = 0;
-  clear_has_kids();
+inline std::string* NodeBatch::add_label_table() {
+  std::string* _s = _internal_add_label_table();
+  // @@protoc_insertion_point(field_add_mutable:message.NodeBatch.label_table)
+  return _s;
 }
-inline ::google::protobuf::int32 Node::kids() const {
-  // @@protoc_insertion_point(field_get:message.Node.kids)
-  return kids_;
+inline const std::string& NodeBatch::_internal_label_table(int index) const {
+  return _impl_.label_table_.Get(index);
 }
-inline void Node::set_kids(::google::protobuf::int32 value) {
-  set_has_kids();
-  kids_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.kids)
+inline const std::string& NodeBatch::label_table(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.label_table)
+  return _internal_label_table(index);
+}
+inline std::string* NodeBatch::mutable_label_table(int index) {
+  // @@protoc_insertion_point(field_mutable:message.NodeBatch.label_table)
+  return _impl_.label_table_.Mutable(index);
+}
+inline void NodeBatch::set_label_table(int index, const std::string& value) {
+  _impl_.label_table_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.label_table)
+}
+inline void NodeBatch::set_label_table(int index, std::string&& value) {
+  _impl_.label_table_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:message.NodeBatch.label_table)
+}
+inline void NodeBatch::set_label_table(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.label_table_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:message.NodeBatch.label_table)
+}
+inline void NodeBatch::set_label_table(int index, const char* value, size_t size) {
+  _impl_.label_table_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:message.NodeBatch.label_table)
+}
+inline std::string* NodeBatch::_internal_add_label_table() {
+  return _impl_.label_table_.Add();
+}
+inline void NodeBatch::add_label_table(const std::string& value) {
+  _impl_.label_table_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.label_table)
+}
+inline void NodeBatch::add_label_table(std::string&& value) {
+  _impl_.label_table_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:message.NodeBatch.label_table)
+}
+inline void NodeBatch::add_label_table(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.label_table_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:message.NodeBatch.label_table)
+}
+inline void NodeBatch::add_label_table(const char* value, size_t size) {
+  _impl_.label_table_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:message.NodeBatch.label_table)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+NodeBatch::label_table() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.label_table)
+  return _impl_.label_table_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+NodeBatch::mutable_label_table() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.label_table)
+  return &_impl_.label_table_;
 }
 
-// optional .message.Node.NodeStatus status = 6;
-inline bool Node::has_status() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+// repeated float domain_size = 11 [packed = true];
+inline int NodeBatch::_internal_domain_size_size() const {
+  return _impl_.domain_size_.size();
 }
-inline void Node::set_has_status() {
-  _has_bits_[0] |= 0x00000020u;
+inline int NodeBatch::domain_size_size() const {
+  return _internal_domain_size_size();
 }
-inline void Node::clear_has_status() {
-  _has_bits_[0] &= ~0x00000020u;
+inline void NodeBatch::clear_domain_size() {
+  _impl_.domain_size_.Clear();
 }
-inline void Node::clear_status() {
-  status_ = 0;
-  clear_has_status();
+inline float NodeBatch::_internal_domain_size(int index) const {
+  return _impl_.domain_size_.Get(index);
 }
-inline ::message::Node_NodeStatus Node::status() const {
-  // @@protoc_insertion_point(field_get:message.Node.status)
-  return static_cast< ::message::Node_NodeStatus >(status_);
+inline float NodeBatch::domain_size(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.domain_size)
+  return _internal_domain_size(index);
 }
-inline void Node::set_status(::message::Node_NodeStatus value) {
-  assert(::message::Node_NodeStatus_IsValid(value));
-  set_has_status();
-  status_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.status)
+inline void NodeBatch::set_domain_size(int index, float value) {
+  _impl_.domain_size_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.domain_size)
+}
+inline void NodeBatch::_internal_add_domain_size(float value) {
+  _impl_.domain_size_.Add(value);
+}
+inline void NodeBatch::add_domain_size(float value) {
+  _internal_add_domain_size(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.domain_size)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+NodeBatch::_internal_domain_size() const {
+  return _impl_.domain_size_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+NodeBatch::domain_size() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.domain_size)
+  return _internal_domain_size();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+NodeBatch::_internal_mutable_domain_size() {
+  return &_impl_.domain_size_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+NodeBatch::mutable_domain_size() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.domain_size)
+  return _internal_mutable_domain_size();
 }
 
-// optional int32 restart_id = 7;
-inline bool Node::has_restart_id() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+// repeated int32 decision_level = 12 [packed = true];
+inline int NodeBatch::_internal_decision_level_size() const {
+  return _impl_.decision_level_.size();
 }
-inline void Node::set_has_restart_id() {
-  _has_bits_[0] |= 0x00000040u;
+inline int NodeBatch::decision_level_size() const {
+  return _internal_decision_level_size();
 }
-inline void Node::clear_has_restart_id() {
-  _has_bits_[0] &= ~0x00000040u;
+inline void NodeBatch::clear_decision_level() {
+  _impl_.decision_level_.Clear();
 }
-inline void Node::clear_restart_id() {
-  restart_id_ = 0;
-  clear_has_restart_id();
+inline int32_t NodeBatch::_internal_decision_level(int index) const {
+  return _impl_.decision_level_.Get(index);
 }
-inline ::google::protobuf::int32 Node::restart_id() const {
-  // @@protoc_insertion_point(field_get:message.Node.restart_id)
-  return restart_id_;
+inline int32_t NodeBatch::decision_level(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.decision_level)
+  return _internal_decision_level(index);
 }
-inline void Node::set_restart_id(::google::protobuf::int32 value) {
-  set_has_restart_id();
-  restart_id_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.restart_id)
+inline void NodeBatch::set_decision_level(int index, int32_t value) {
+  _impl_.decision_level_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.decision_level)
+}
+inline void NodeBatch::_internal_add_decision_level(int32_t value) {
+  _impl_.decision_level_.Add(value);
+}
+inline void NodeBatch::add_decision_level(int32_t value) {
+  _internal_add_decision_level(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.decision_level)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_decision_level() const {
+  return _impl_.decision_level_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::decision_level() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.decision_level)
+  return _internal_decision_level();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_decision_level() {
+  return &_impl_.decision_level_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_decision_level() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.decision_level)
+  return _internal_mutable_decision_level();
 }
 
-// optional uint64 time = 8;
-inline bool Node::has_time() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
+// repeated int32 nogood_idx = 13 [packed = true];
+inline int NodeBatch::_internal_nogood_idx_size() const {
+  return _impl_.nogood_idx_.size();
 }
-inline void Node::set_has_time() {
-  _has_bits_[0] |= 0x00000080u;
+inline int NodeBatch::nogood_idx_size() const {
+  return _internal_nogood_idx_size();
 }
-inline void Node::clear_has_time() {
-  _has_bits_[0] &= ~0x00000080u;
+inline void NodeBatch::clear_nogood_idx() {
+  _impl_.nogood_idx_.Clear();
 }
-inline void Node::clear_time() {
-  time_ = GOOGLE_ULONGLONG(0);
-  clear_has_time();
+inline int32_t NodeBatch::_internal_nogood_idx(int index) const {
+  return _impl_.nogood_idx_.Get(index);
 }
-inline ::google::protobuf::uint64 Node::time() const {
-  // @@protoc_insertion_point(field_get:message.Node.time)
-  return time_;
+inline int32_t NodeBatch::nogood_idx(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.nogood_idx)
+  return _internal_nogood_idx(index);
 }
-inline void Node::set_time(::google::protobuf::uint64 value) {
-  set_has_time();
-  time_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.time)
+inline void NodeBatch::set_nogood_idx(int index, int32_t value) {
+  _impl_.nogood_idx_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.nogood_idx)
+}
+inline void NodeBatch::_internal_add_nogood_idx(int32_t value) {
+  _impl_.nogood_idx_.Add(value);
+}
+inline void NodeBatch::add_nogood_idx(int32_t value) {
+  _internal_add_nogood_idx(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.nogood_idx)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_nogood_idx() const {
+  return _impl_.nogood_idx_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::nogood_idx() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.nogood_idx)
+  return _internal_nogood_idx();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_nogood_idx() {
+  return &_impl_.nogood_idx_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_nogood_idx() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.nogood_idx)
+  return _internal_mutable_nogood_idx();
 }
 
-// optional int32 thread_id = 9;
-inline bool Node::has_thread_id() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+// repeated string nogood = 14;
+inline int NodeBatch::_internal_nogood_size() const {
+  return _impl_.nogood_.size();
 }
-inline void Node::set_has_thread_id() {
-  _has_bits_[0] |= 0x00000100u;
+inline int NodeBatch::nogood_size() const {
+  return _internal_nogood_size();
 }
-inline void Node::clear_has_thread_id() {
-  _has_bits_[0] &= ~0x00000100u;
+inline void NodeBatch::clear_nogood() {
+  _impl_.nogood_.Clear();
 }
-inline void Node::clear_thread_id() {
-  thread_id_ = 0;
-  clear_has_thread_id();
+inline std::string* NodeBatch::add_nogood() {
+  std::string* _s = _internal_add_nogood();
+  // @@protoc_insertion_point(field_add_mutable:message.NodeBatch.nogood)
+  return _s;
 }
-inline ::google::protobuf::int32 Node::thread_id() const {
-  // @@protoc_insertion_point(field_get:message.Node.thread_id)
-  return thread_id_;
+inline const std::string& NodeBatch::_internal_nogood(int index) const {
+  return _impl_.nogood_.Get(index);
 }
-inline void Node::set_thread_id(::google::protobuf::int32 value) {
-  set_has_thread_id();
-  thread_id_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.thread_id)
+inline const std::string& NodeBatch::nogood(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.nogood)
+  return _internal_nogood(index);
+}
+inline std::string* NodeBatch::mutable_nogood(int index) {
+  // @@protoc_insertion_point(field_mutable:message.NodeBatch.nogood)
+  return _impl_.nogood_.Mutable(index);
+}
+inline void NodeBatch::set_nogood(int index, const std::string& value) {
+  _impl_.nogood_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.nogood)
+}
+inline void NodeBatch::set_nogood(int index, std::string&& value) {
+  _impl_.nogood_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:message.NodeBatch.nogood)
+}
+inline void NodeBatch::set_nogood(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.nogood_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:message.NodeBatch.nogood)
+}
+inline void NodeBatch::set_nogood(int index, const char* value, size_t size) {
+  _impl_.nogood_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:message.NodeBatch.nogood)
+}
+inline std::string* NodeBatch::_internal_add_nogood() {
+  return _impl_.nogood_.Add();
+}
+inline void NodeBatch::add_nogood(const std::string& value) {
+  _impl_.nogood_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.nogood)
+}
+inline void NodeBatch::add_nogood(std::string&& value) {
+  _impl_.nogood_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:message.NodeBatch.nogood)
+}
+inline void NodeBatch::add_nogood(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.nogood_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:message.NodeBatch.nogood)
+}
+inline void NodeBatch::add_nogood(const char* value, size_t size) {
+  _impl_.nogood_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:message.NodeBatch.nogood)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+NodeBatch::nogood() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.nogood)
+  return _impl_.nogood_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+NodeBatch::mutable_nogood() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.nogood)
+  return &_impl_.nogood_;
 }
 
-// optional string label = 10;
-inline bool Node::has_label() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
+// repeated int32 info_idx = 15 [packed = true];
+inline int NodeBatch::_internal_info_idx_size() const {
+  return _impl_.info_idx_.size();
 }
-inline void Node::set_has_label() {
-  _has_bits_[0] |= 0x00000200u;
+inline int NodeBatch::info_idx_size() const {
+  return _internal_info_idx_size();
 }
-inline void Node::clear_has_label() {
-  _has_bits_[0] &= ~0x00000200u;
+inline void NodeBatch::clear_info_idx() {
+  _impl_.info_idx_.Clear();
 }
-inline void Node::clear_label() {
-  if (label_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    label_->clear();
-  }
-  clear_has_label();
+inline int32_t NodeBatch::_internal_info_idx(int index) const {
+  return _impl_.info_idx_.Get(index);
 }
-inline const ::std::string& Node::label() const {
-  // @@protoc_insertion_point(field_get:message.Node.label)
-  return *label_;
+inline int32_t NodeBatch::info_idx(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.info_idx)
+  return _internal_info_idx(index);
 }
-inline void Node::set_label(const ::std::string& value) {
-  set_has_label();
-  if (label_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    label_ = new ::std::string;
-  }
-  label_->assign(value);
-  // @@protoc_insertion_point(field_set:message.Node.label)
+inline void NodeBatch::set_info_idx(int index, int32_t value) {
+  _impl_.info_idx_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.info_idx)
 }
-inline void Node::set_label(const char* value) {
-  set_has_label();
-  if (label_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    label_ = new ::std::string;
-  }
-  label_->assign(value);
-  // @@protoc_insertion_point(field_set_char:message.Node.label)
+inline void NodeBatch::_internal_add_info_idx(int32_t value) {
+  _impl_.info_idx_.Add(value);
 }
-inline void Node::set_label(const char* value, size_t size) {
-  set_has_label();
-  if (label_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    label_ = new ::std::string;
-  }
-  label_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:message.Node.label)
+inline void NodeBatch::add_info_idx(int32_t value) {
+  _internal_add_info_idx(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.info_idx)
 }
-inline ::std::string* Node::mutable_label() {
-  set_has_label();
-  if (label_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    label_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:message.Node.label)
-  return label_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_info_idx() const {
+  return _impl_.info_idx_;
 }
-inline ::std::string* Node::release_label() {
-  clear_has_label();
-  if (label_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = label_;
-    label_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::info_idx() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.info_idx)
+  return _internal_info_idx();
 }
-inline void Node::set_allocated_label(::std::string* label) {
-  if (label_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete label_;
-  }
-  if (label) {
-    set_has_label();
-    label_ = label;
-  } else {
-    clear_has_label();
-    label_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:message.Node.label)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_info_idx() {
+  return &_impl_.info_idx_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_info_idx() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.info_idx)
+  return _internal_mutable_info_idx();
 }
 
-// optional float domain_size = 11;
-inline bool Node::has_domain_size() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
+// repeated string info = 16;
+inline int NodeBatch::_internal_info_size() const {
+  return _impl_.info_.size();
 }
-inline void Node::set_has_domain_size() {
-  _has_bits_[0] |= 0x00000400u;
+inline int NodeBatch::info_size() const {
+  return _internal_info_size();
 }
-inline void Node::clear_has_domain_size() {
-  _has_bits_[0] &= ~0x00000400u;
+inline void NodeBatch::clear_info() {
+  _impl_.info_.Clear();
 }
-inline void Node::clear_domain_size() {
-  domain_size_ = 0;
-  clear_has_domain_size();
+inline std::string* NodeBatch::add_info() {
+  std::string* _s = _internal_add_info();
+  // @@protoc_insertion_point(field_add_mutable:message.NodeBatch.info)
+  return _s;
 }
-inline float Node::domain_size() const {
-  // @@protoc_insertion_point(field_get:message.Node.domain_size)
-  return domain_size_;
+inline const std::string& NodeBatch::_internal_info(int index) const {
+  return _impl_.info_.Get(index);
 }
-inline void Node::set_domain_size(float value) {
-  set_has_domain_size();
-  domain_size_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.domain_size)
+inline const std::string& NodeBatch::info(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.info)
+  return _internal_info(index);
+}
+inline std::string* NodeBatch::mutable_info(int index) {
+  // @@protoc_insertion_point(field_mutable:message.NodeBatch.info)
+  return _impl_.info_.Mutable(index);
+}
+inline void NodeBatch::set_info(int index, const std::string& value) {
+  _impl_.info_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.info)
+}
+inline void NodeBatch::set_info(int index, std::string&& value) {
+  _impl_.info_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:message.NodeBatch.info)
+}
+inline void NodeBatch::set_info(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.info_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:message.NodeBatch.info)
+}
+inline void NodeBatch::set_info(int index, const char* value, size_t size) {
+  _impl_.info_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:message.NodeBatch.info)
+}
+inline std::string* NodeBatch::_internal_add_info() {
+  return _impl_.info_.Add();
+}
+inline void NodeBatch::add_info(const std::string& value) {
+  _impl_.info_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.info)
+}
+inline void NodeBatch::add_info(std::string&& value) {
+  _impl_.info_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:message.NodeBatch.info)
+}
+inline void NodeBatch::add_info(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.info_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:message.NodeBatch.info)
+}
+inline void NodeBatch::add_info(const char* value, size_t size) {
+  _impl_.info_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:message.NodeBatch.info)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+NodeBatch::info() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.info)
+  return _impl_.info_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+NodeBatch::mutable_info() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.info)
+  return &_impl_.info_;
 }
 
-// optional string solution = 12;
-inline bool Node::has_solution() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
+// repeated int32 label_id = 17 [packed = true];
+inline int NodeBatch::_internal_label_id_size() const {
+  return _impl_.label_id_.size();
 }
-inline void Node::set_has_solution() {
-  _has_bits_[0] |= 0x00000800u;
+inline int NodeBatch::label_id_size() const {
+  return _internal_label_id_size();
 }
-inline void Node::clear_has_solution() {
-  _has_bits_[0] &= ~0x00000800u;
+inline void NodeBatch::clear_label_id() {
+  _impl_.label_id_.Clear();
 }
-inline void Node::clear_solution() {
-  if (solution_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    solution_->clear();
-  }
-  clear_has_solution();
+inline int32_t NodeBatch::_internal_label_id(int index) const {
+  return _impl_.label_id_.Get(index);
 }
-inline const ::std::string& Node::solution() const {
-  // @@protoc_insertion_point(field_get:message.Node.solution)
-  return *solution_;
+inline int32_t NodeBatch::label_id(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.label_id)
+  return _internal_label_id(index);
 }
-inline void Node::set_solution(const ::std::string& value) {
-  set_has_solution();
-  if (solution_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    solution_ = new ::std::string;
-  }
-  solution_->assign(value);
-  // @@protoc_insertion_point(field_set:message.Node.solution)
+inline void NodeBatch::set_label_id(int index, int32_t value) {
+  _impl_.label_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.label_id)
 }
-inline void Node::set_solution(const char* value) {
-  set_has_solution();
-  if (solution_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    solution_ = new ::std::string;
-  }
-  solution_->assign(value);
-  // @@protoc_insertion_point(field_set_char:message.Node.solution)
+inline void NodeBatch::_internal_add_label_id(int32_t value) {
+  _impl_.label_id_.Add(value);
 }
-inline void Node::set_solution(const char* value, size_t size) {
-  set_has_solution();
-  if (solution_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    solution_ = new ::std::string;
-  }
-  solution_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:message.Node.solution)
+inline void NodeBatch::add_label_id(int32_t value) {
+  _internal_add_label_id(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.label_id)
 }
-inline ::std::string* Node::mutable_solution() {
-  set_has_solution();
-  if (solution_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    solution_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:message.Node.solution)
-  return solution_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_label_id() const {
+  return _impl_.label_id_;
 }
-inline ::std::string* Node::release_solution() {
-  clear_has_solution();
-  if (solution_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = solution_;
-    solution_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::label_id() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.label_id)
+  return _internal_label_id();
 }
-inline void Node::set_allocated_solution(::std::string* solution) {
-  if (solution_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete solution_;
-  }
-  if (solution) {
-    set_has_solution();
-    solution_ = solution;
-  } else {
-    clear_has_solution();
-    solution_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:message.Node.solution)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_label_id() {
+  return &_impl_.label_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_label_id() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.label_id)
+  return _internal_mutable_label_id();
 }
 
-// optional string nogood = 13;
-inline bool Node::has_nogood() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
+// repeated sint32 sid_delta = 18 [packed = true];
+inline int NodeBatch::_internal_sid_delta_size() const {
+  return _impl_.sid_delta_.size();
 }
-inline void Node::set_has_nogood() {
-  _has_bits_[0] |= 0x00001000u;
+inline int NodeBatch::sid_delta_size() const {
+  return _internal_sid_delta_size();
 }
-inline void Node::clear_has_nogood() {
-  _has_bits_[0] &= ~0x00001000u;
+inline void NodeBatch::clear_sid_delta() {
+  _impl_.sid_delta_.Clear();
 }
-inline void Node::clear_nogood() {
-  if (nogood_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    nogood_->clear();
-  }
-  clear_has_nogood();
+inline int32_t NodeBatch::_internal_sid_delta(int index) const {
+  return _impl_.sid_delta_.Get(index);
 }
-inline const ::std::string& Node::nogood() const {
-  // @@protoc_insertion_point(field_get:message.Node.nogood)
-  return *nogood_;
+inline int32_t NodeBatch::sid_delta(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.sid_delta)
+  return _internal_sid_delta(index);
 }
-inline void Node::set_nogood(const ::std::string& value) {
-  set_has_nogood();
-  if (nogood_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    nogood_ = new ::std::string;
-  }
-  nogood_->assign(value);
-  // @@protoc_insertion_point(field_set:message.Node.nogood)
+inline void NodeBatch::set_sid_delta(int index, int32_t value) {
+  _impl_.sid_delta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.sid_delta)
 }
-inline void Node::set_nogood(const char* value) {
-  set_has_nogood();
-  if (nogood_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    nogood_ = new ::std::string;
-  }
-  nogood_->assign(value);
-  // @@protoc_insertion_point(field_set_char:message.Node.nogood)
+inline void NodeBatch::_internal_add_sid_delta(int32_t value) {
+  _impl_.sid_delta_.Add(value);
 }
-inline void Node::set_nogood(const char* value, size_t size) {
-  set_has_nogood();
-  if (nogood_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    nogood_ = new ::std::string;
-  }
-  nogood_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:message.Node.nogood)
+inline void NodeBatch::add_sid_delta(int32_t value) {
+  _internal_add_sid_delta(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.sid_delta)
 }
-inline ::std::string* Node::mutable_nogood() {
-  set_has_nogood();
-  if (nogood_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    nogood_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:message.Node.nogood)
-  return nogood_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_sid_delta() const {
+  return _impl_.sid_delta_;
 }
-inline ::std::string* Node::release_nogood() {
-  clear_has_nogood();
-  if (nogood_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = nogood_;
-    nogood_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::sid_delta() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.sid_delta)
+  return _internal_sid_delta();
 }
-inline void Node::set_allocated_nogood(::std::string* nogood) {
-  if (nogood_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete nogood_;
-  }
-  if (nogood) {
-    set_has_nogood();
-    nogood_ = nogood;
-  } else {
-    clear_has_nogood();
-    nogood_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:message.Node.nogood)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_sid_delta() {
+  return &_impl_.sid_delta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_sid_delta() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.sid_delta)
+  return _internal_mutable_sid_delta();
 }
 
-// optional string info = 14;
-inline bool Node::has_info() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
+// repeated sint32 pid_delta = 19 [packed = true];
+inline int NodeBatch::_internal_pid_delta_size() const {
+  return _impl_.pid_delta_.size();
 }
-inline void Node::set_has_info() {
-  _has_bits_[0] |= 0x00002000u;
+inline int NodeBatch::pid_delta_size() const {
+  return _internal_pid_delta_size();
 }
-inline void Node::clear_has_info() {
-  _has_bits_[0] &= ~0x00002000u;
+inline void NodeBatch::clear_pid_delta() {
+  _impl_.pid_delta_.Clear();
 }
-inline void Node::clear_info() {
-  if (info_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    info_->clear();
-  }
-  clear_has_info();
+inline int32_t NodeBatch::_internal_pid_delta(int index) const {
+  return _impl_.pid_delta_.Get(index);
 }
-inline const ::std::string& Node::info() const {
-  // @@protoc_insertion_point(field_get:message.Node.info)
-  return *info_;
+inline int32_t NodeBatch::pid_delta(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.pid_delta)
+  return _internal_pid_delta(index);
 }
-inline void Node::set_info(const ::std::string& value) {
-  set_has_info();
-  if (info_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    info_ = new ::std::string;
-  }
-  info_->assign(value);
-  // @@protoc_insertion_point(field_set:message.Node.info)
+inline void NodeBatch::set_pid_delta(int index, int32_t value) {
+  _impl_.pid_delta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.pid_delta)
 }
-inline void Node::set_info(const char* value) {
-  set_has_info();
-  if (info_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    info_ = new ::std::string;
-  }
-  info_->assign(value);
-  // @@protoc_insertion_point(field_set_char:message.Node.info)
+inline void NodeBatch::_internal_add_pid_delta(int32_t value) {
+  _impl_.pid_delta_.Add(value);
 }
-inline void Node::set_info(const char* value, size_t size) {
-  set_has_info();
-  if (info_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    info_ = new ::std::string;
-  }
-  info_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:message.Node.info)
+inline void NodeBatch::add_pid_delta(int32_t value) {
+  _internal_add_pid_delta(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.pid_delta)
 }
-inline ::std::string* Node::mutable_info() {
-  set_has_info();
-  if (info_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    info_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:message.Node.info)
-  return info_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_pid_delta() const {
+  return _impl_.pid_delta_;
 }
-inline ::std::string* Node::release_info() {
-  clear_has_info();
-  if (info_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = info_;
-    info_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::pid_delta() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.pid_delta)
+  return _internal_pid_delta();
 }
-inline void Node::set_allocated_info(::std::string* info) {
-  if (info_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete info_;
-  }
-  if (info) {
-    set_has_info();
-    info_ = info;
-  } else {
-    clear_has_info();
-    info_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:message.Node.info)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_pid_delta() {
+  return &_impl_.pid_delta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_pid_delta() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.pid_delta)
+  return _internal_mutable_pid_delta();
 }
 
-// optional int32 nogood_bld = 15;
-inline bool Node::has_nogood_bld() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
+// repeated sint64 time_delta = 20 [packed = true];
+inline int NodeBatch::_internal_time_delta_size() const {
+  return _impl_.time_delta_.size();
 }
-inline void Node::set_has_nogood_bld() {
-  _has_bits_[0] |= 0x00004000u;
+inline int NodeBatch::time_delta_size() const {
+  return _internal_time_delta_size();
 }
-inline void Node::clear_has_nogood_bld() {
-  _has_bits_[0] &= ~0x00004000u;
+inline void NodeBatch::clear_time_delta() {
+  _impl_.time_delta_.Clear();
 }
-inline void Node::clear_nogood_bld() {
-  nogood_bld_ = 0;
-  clear_has_nogood_bld();
+inline int64_t NodeBatch::_internal_time_delta(int index) const {
+  return _impl_.time_delta_.Get(index);
 }
-inline ::google::protobuf::int32 Node::nogood_bld() const {
-  // @@protoc_insertion_point(field_get:message.Node.nogood_bld)
-  return nogood_bld_;
+inline int64_t NodeBatch::time_delta(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.time_delta)
+  return _internal_time_delta(index);
 }
-inline void Node::set_nogood_bld(::google::protobuf::int32 value) {
-  set_has_nogood_bld();
-  nogood_bld_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.nogood_bld)
+inline void NodeBatch::set_time_delta(int index, int64_t value) {
+  _impl_.time_delta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.time_delta)
+}
+inline void NodeBatch::_internal_add_time_delta(int64_t value) {
+  _impl_.time_delta_.Add(value);
+}
+inline void NodeBatch::add_time_delta(int64_t value) {
+  _internal_add_time_delta(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.time_delta)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+NodeBatch::_internal_time_delta() const {
+  return _impl_.time_delta_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+NodeBatch::time_delta() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.time_delta)
+  return _internal_time_delta();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+NodeBatch::_internal_mutable_time_delta() {
+  return &_impl_.time_delta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+NodeBatch::mutable_time_delta() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.time_delta)
+  return _internal_mutable_time_delta();
 }
 
-// optional bool uses_assumptions = 16;
-inline bool Node::has_uses_assumptions() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
+// repeated int32 nogood_bld = 21 [packed = true];
+inline int NodeBatch::_internal_nogood_bld_size() const {
+  return _impl_.nogood_bld_.size();
 }
-inline void Node::set_has_uses_assumptions() {
-  _has_bits_[0] |= 0x00008000u;
+inline int NodeBatch::nogood_bld_size() const {
+  return _internal_nogood_bld_size();
 }
-inline void Node::clear_has_uses_assumptions() {
-  _has_bits_[0] &= ~0x00008000u;
+inline void NodeBatch::clear_nogood_bld() {
+  _impl_.nogood_bld_.Clear();
 }
-inline void Node::clear_uses_assumptions() {
-  uses_assumptions_ = false;
-  clear_has_uses_assumptions();
+inline int32_t NodeBatch::_internal_nogood_bld(int index) const {
+  return _impl_.nogood_bld_.Get(index);
 }
-inline bool Node::uses_assumptions() const {
-  // @@protoc_insertion_point(field_get:message.Node.uses_assumptions)
-  return uses_assumptions_;
+inline int32_t NodeBatch::nogood_bld(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.nogood_bld)
+  return _internal_nogood_bld(index);
 }
-inline void Node::set_uses_assumptions(bool value) {
-  set_has_uses_assumptions();
-  uses_assumptions_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.uses_assumptions)
+inline void NodeBatch::set_nogood_bld(int index, int32_t value) {
+  _impl_.nogood_bld_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.nogood_bld)
+}
+inline void NodeBatch::_internal_add_nogood_bld(int32_t value) {
+  _impl_.nogood_bld_.Add(value);
+}
+inline void NodeBatch::add_nogood_bld(int32_t value) {
+  _internal_add_nogood_bld(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.nogood_bld)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_nogood_bld() const {
+  return _impl_.nogood_bld_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::nogood_bld() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.nogood_bld)
+  return _internal_nogood_bld();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_nogood_bld() {
+  return &_impl_.nogood_bld_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_nogood_bld() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.nogood_bld)
+  return _internal_mutable_nogood_bld();
 }
 
-// optional int32 backjump_distance = 17;
-inline bool Node::has_backjump_distance() const {
-  return (_has_bits_[0] & 0x00010000u) != 0;
+// repeated bool uses_assumptions = 22 [packed = true];
+inline int NodeBatch::_internal_uses_assumptions_size() const {
+  return _impl_.uses_assumptions_.size();
 }
-inline void Node::set_has_backjump_distance() {
-  _has_bits_[0] |= 0x00010000u;
+inline int NodeBatch::uses_assumptions_size() const {
+  return _internal_uses_assumptions_size();
 }
-inline void Node::clear_has_backjump_distance() {
-  _has_bits_[0] &= ~0x00010000u;
+inline void NodeBatch::clear_uses_assumptions() {
+  _impl_.uses_assumptions_.Clear();
 }
-inline void Node::clear_backjump_distance() {
-  backjump_distance_ = 0;
-  clear_has_backjump_distance();
+inline bool NodeBatch::_internal_uses_assumptions(int index) const {
+  return _impl_.uses_assumptions_.Get(index);
 }
-inline ::google::protobuf::int32 Node::backjump_distance() const {
-  // @@protoc_insertion_point(field_get:message.Node.backjump_distance)
-  return backjump_distance_;
+inline bool NodeBatch::uses_assumptions(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.uses_assumptions)
+  return _internal_uses_assumptions(index);
 }
-inline void Node::set_backjump_distance(::google::protobuf::int32 value) {
-  set_has_backjump_distance();
-  backjump_distance_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.backjump_distance)
+inline void NodeBatch::set_uses_assumptions(int index, bool value) {
+  _impl_.uses_assumptions_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.uses_assumptions)
+}
+inline void NodeBatch::_internal_add_uses_assumptions(bool value) {
+  _impl_.uses_assumptions_.Add(value);
+}
+inline void NodeBatch::add_uses_assumptions(bool value) {
+  _internal_add_uses_assumptions(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.uses_assumptions)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+NodeBatch::_internal_uses_assumptions() const {
+  return _impl_.uses_assumptions_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+NodeBatch::uses_assumptions() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.uses_assumptions)
+  return _internal_uses_assumptions();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+NodeBatch::_internal_mutable_uses_assumptions() {
+  return &_impl_.uses_assumptions_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+NodeBatch::mutable_uses_assumptions() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.uses_assumptions)
+  return _internal_mutable_uses_assumptions();
 }
 
-// optional int32 decision_level = 18;
-inline bool Node::has_decision_level() const {
-  return (_has_bits_[0] & 0x00020000u) != 0;
+// repeated int32 backjump_distance = 23 [packed = true];
+inline int NodeBatch::_internal_backjump_distance_size() const {
+  return _impl_.backjump_distance_.size();
 }
-inline void Node::set_has_decision_level() {
-  _has_bits_[0] |= 0x00020000u;
+inline int NodeBatch::backjump_distance_size() const {
+  return _internal_backjump_distance_size();
 }
-inline void Node::clear_has_decision_level() {
-  _has_bits_[0] &= ~0x00020000u;
+inline void NodeBatch::clear_backjump_distance() {
+  _impl_.backjump_distance_.Clear();
 }
-inline void Node::clear_decision_level() {
-  decision_level_ = 0;
-  clear_has_decision_level();
+inline int32_t NodeBatch::_internal_backjump_distance(int index) const {
+  return _impl_.backjump_distance_.Get(index);
 }
-inline ::google::protobuf::int32 Node::decision_level() const {
-  // @@protoc_insertion_point(field_get:message.Node.decision_level)
-  return decision_level_;
+inline int32_t NodeBatch::backjump_distance(int index) const {
+  // @@protoc_insertion_point(field_get:message.NodeBatch.backjump_distance)
+  return _internal_backjump_distance(index);
 }
-inline void Node::set_decision_level(::google::protobuf::int32 value) {
-  set_has_decision_level();
-  decision_level_ = value;
-  // @@protoc_insertion_point(field_set:message.Node.decision_level)
+inline void NodeBatch::set_backjump_distance(int index, int32_t value) {
+  _impl_.backjump_distance_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.NodeBatch.backjump_distance)
+}
+inline void NodeBatch::_internal_add_backjump_distance(int32_t value) {
+  _impl_.backjump_distance_.Add(value);
 }
+inline void NodeBatch::add_backjump_distance(int32_t value) {
+  _internal_add_backjump_distance(value);
+  // @@protoc_insertion_point(field_add:message.NodeBatch.backjump_distance)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::_internal_backjump_distance() const {
+  return _impl_.backjump_distance_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+NodeBatch::backjump_distance() const {
+  // @@protoc_insertion_point(field_list:message.NodeBatch.backjump_distance)
+  return _internal_backjump_distance();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::_internal_mutable_backjump_distance() {
+  return &_impl_.backjump_distance_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+NodeBatch::mutable_backjump_distance() {
+  // @@protoc_insertion_point(field_mutable_list:message.NodeBatch.backjump_distance)
+  return _internal_mutable_backjump_distance();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
 
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace message
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
-template <> struct is_proto_enum< ::message::Node_MsgType> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::message::Node_MsgType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::message::Node_MsgType>() {
   return ::message::Node_MsgType_descriptor();
 }
-template <> struct is_proto_enum< ::message::Node_NodeStatus> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::message::Node_NodeStatus> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::message::Node_NodeStatus>() {
   return ::message::Node_NodeStatus_descriptor();
 }
+template <> struct is_proto_enum< ::message::Node_Encoding> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::message::Node_Encoding>() {
+  return ::message::Node_Encoding_descriptor();
+}
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_message_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_message_2eproto
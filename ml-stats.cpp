@@ -132,31 +132,16 @@ public:
         enter();
     }
 
-    int getNogoodStringLength(int sid) {
-        std::unordered_map<int64_t, string>::const_iterator it = execution->getNogoods().find(sid);
-        if (it != execution->getNogoods().end()) {
-            return it->second.length();
-        } else {
-            return 0;
-        }
+    int getNogoodStringLength(int64_t sid) {
+        return execution->getNogoods().get(sid).length();
     }
 
-    string getNogoodString(int sid) {
-        std::unordered_map<int64_t, string>::const_iterator it = execution->getNogoods().find(sid);
-        if (it != execution->getNogoods().end()) {
-            return it->second;
-        } else {
-            return "";
-        }
+    string getNogoodString(int64_t sid) {
+        return execution->getNogoods().get(sid);
     }
 
-    string getSolutionString(int sid) {
-        std::unordered_map<int64_t, string*>::const_iterator it = execution->getInfo().find(sid);
-        if (it != execution->getInfo().end()) {
-            return *it->second;
-        } else {
-            return "";
-        }
+    string getSolutionString(int64_t sid) {
+        return execution->getInfo().get(sid);
     }
 
     int calculateNogoodLength(string nogood) {
@@ -210,24 +195,24 @@ public:
         // Some nodes (e.g. undetermined nodes) do not have entries;
         // be careful with those.
         se.gid = gid;
-        DbEntry* entry = execution->getEntry(gid);
-        if (entry != nullptr) {
-            unsigned int sid = entry->s_node_id;
+        DbEntry entry = execution->getEntry(gid);
+        if (entry) {
+            unsigned int sid = entry.s_node_id();
             se.nodeid = sid;
-            se.parentid = entry->parent_sid;
-            se.alternative = entry->alt;
-            // se.restartNumber = entry->restart_id;
-            se.nogoodStringLength = getNogoodStringLength(sid);
-            se.nogoodString = getNogoodString(sid);
+            se.parentid = entry.parent_sid();
+            se.alternative = entry.alt();
+            // se.restartNumber = entry.restart_id();
+            se.nogoodStringLength = getNogoodStringLength(entry.full_sid());
+            se.nogoodString = getNogoodString(entry.full_sid());
             se.nogoodLength = calculateNogoodLength(se.nogoodString);
             se.nogoodNumberVariables = calculateNogoodNumberVariables(se.nogoodString);
-            se.nogoodBLD = entry->nogood_bld;
-            se.usesAssumptions = entry->usesAssumptions;
-            se.backjumpDistance = entry->backjump_distance;
-            se.label = entry->label;
-            se.decisionLevel = entry->decision_level;
-            se.timestamp = entry->time_stamp;
-            se.solutionString = getSolutionString(sid);
+            se.nogoodBLD = entry.nogood_bld();
+            se.usesAssumptions = entry.usesAssumptions();
+            se.backjumpDistance = entry.backjump_distance();
+            se.label = Data::labelOf(entry);
+            se.decisionLevel = entry.decision_level();
+            se.timestamp = entry.time_stamp();
+            se.solutionString = getSolutionString(entry.full_sid());
 
             se.backjumpDestination = se.decisionLevel - se.backjumpDistance;
         } else {
@@ -71,6 +71,7 @@ Node::setNumberOfChildren(unsigned int n, NodeAllocator& na) {
     {
         noOfChildren = n;
         int* children = heap.alloc<int>(n);
+        na.countChildBytes(sizeof(int) * n);
         childrenOrFirstChild = static_cast<void*>(children);
         setTag(MORE_CHILDREN);
         for (unsigned int i=n; i--;)
@@ -97,6 +98,7 @@ Node::addChild(NodeAllocator &na) {
     case 2:
     {
         int* children = heap.alloc<int>(3);
+        na.countChildBytes(sizeof(int) * 3);
         children[0] = getFirstChild();
         children[1] = -noOfChildren;
         children[2] = na.allocate(getIndex(na));
@@ -111,6 +113,7 @@ Node::addChild(NodeAllocator &na) {
         noOfChildren++;
         int* oldchildren = static_cast<int*>(getPtr());
         int* newchildren = heap.realloc<int>(oldchildren,noOfChildren-1,noOfChildren);
+        na.countChildBytes(sizeof(int));
         // for (int i=0; i<noOfChildren-1; i++)
         //     assert(oldchildren[i]==newchildren[i]);
         newchildren[noOfChildren-1] = na.allocate(getIndex(na));
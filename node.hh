@@ -66,6 +66,10 @@ private:
   /// The parent of this node, or nullptr for the root
   int parent;
 
+  /// The index of this node in its NodeAllocator, set when allocated
+  int index;
+  friend class NodeAllocator;
+
   /// Read the tag of childrenOrFirstChild
   unsigned int getTag(void) const;
   /// Set the tag of childrenOrFirstChild
@@ -100,7 +104,7 @@ public:
   /// Return child no \a n
   VisualNode* getChild(const NodeAllocator& na, int n) const;
 
-  /// Return index of this node
+  /// Return index of this node (\a na is the allocator it is in)
   int getIndex(const NodeAllocator& na) const;
 
   /// Check if this node is the root of a tree
@@ -115,6 +119,11 @@ public:
   /// Return the number of children
   unsigned int getNumberOfChildren(void) const;
 
+  /// Renumber the parent and children, index i becoming map(i) (the
+  /// parent of a root is -1)
+  template <typename Map>
+  void renumber(Map map);
+
   /// for multithreaded search (drawing)
   /// thread id
   char _tid;  // TODO: take out of Node class; assigned in treebuilder
@@ -65,7 +65,7 @@ Node::getFirstChild(void) const {
 }
 
 inline
-Node::Node(int p, bool failed) : parent(p) {
+Node::Node(int p, bool failed) : parent(p), index(-1) {
   childrenOrFirstChild = nullptr;
   noOfChildren = 0;
   setTag(failed ? LEAF : UNDET);
@@ -117,19 +117,33 @@ Node::getNumberOfChildren(void) const {
   }
 }
 
-inline int
-Node::getIndex(const NodeAllocator& na) const {
-//  int j;
-  if (parent==-1)
-    return 0;
-  Node* p = na[parent];
-  for (int i=p->getNumberOfChildren(); i--;)
-    if (p->getChild(na,i) == this){
-//      j = p->getChild(i);
-      return p->getChild(i);
+template <typename Map>
+inline void
+Node::renumber(Map map) {
+  parent = map(parent);
+  index = map(index);
+  switch (getTag()) {
+  case TWO_CHILDREN:
+    childrenOrFirstChild = reinterpret_cast<void*>(
+      (static_cast<ptrdiff_t>(map(getFirstChild())) << 2) | TWO_CHILDREN);
+    if (noOfChildren <= 0)
+      noOfChildren = -map(-noOfChildren);
+    break;
+  case MORE_CHILDREN:
+    {
+      int* children = static_cast<int*>(getPtr());
+      for (int i = 0; i < noOfChildren; i++)
+        children[i] = map(children[i]);
     }
-  GECODE_NEVER;
-   return -1;
+    break;
+  default:
+    break;
+  }
+}
+
+inline int
+Node::getIndex(const NodeAllocator&) const {
+  return index;
 }
 
 
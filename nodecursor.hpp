@@ -572,6 +572,7 @@ DisposeCursor::DisposeCursor(VisualNode* root,
 
 inline void
 DisposeCursor::processCurrentNode(void) {
+    na.countShapeBytes(-static_cast<long long>(node()->shapeBytes()));
     node()->dispose();
 }
 
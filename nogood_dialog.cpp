@@ -31,7 +31,7 @@ const int NogoodDialog::DEFAULT_HEIGHT = 400;
 
 NogoodDialog::NogoodDialog(
     QWidget* parent, TreeCanvas& tc, const std::vector<int>& selected_nodes,
-    const std::unordered_map<int64_t, std::string>& sid2nogood)
+    const BlobStore& sid2nogood)
     : QDialog(parent), _tc(tc), _sid2nogood(sid2nogood) {
   _model = new QStandardItemModel(0, 2, this);
 
@@ -76,13 +76,13 @@ void NogoodDialog::populateTable(const std::vector<int>& selected_nodes) {
 
     /// TODO(maxim): check if a node is a failure node
 
-    auto ng_item = _sid2nogood.find(sid);
-    if (ng_item == _sid2nogood.end()) {
+    auto nogood = _sid2nogood.get(sid);
+    if (nogood.empty()) {
       continue;  /// nogood not found
     }
 
     _model->setItem(row, 0, new QStandardItem(QString::number(gid)));
-    _model->setItem(row, 1, new QStandardItem((ng_item->second).c_str()));
+    _model->setItem(row, 1, new QStandardItem(nogood.c_str()));
     row++;
   }
 
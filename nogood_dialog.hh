@@ -32,6 +32,7 @@
 
 class TreeCanvas;
 class QStandardItemModel;
+class BlobStore;
 
 class MyProxyModel : public QSortFilterProxyModel {
  public:
@@ -72,7 +73,7 @@ class NogoodDialog : public QDialog {
 
   // QTableWidget* _nogoodTable;
   QTableView* _nogoodTable;
-  const std::unordered_map<int64_t, std::string>& _sid2nogood;
+  const BlobStore& _sid2nogood;
 
   QStandardItemModel* _model;
   MyProxyModel* _proxy_model;
@@ -88,7 +89,7 @@ class NogoodDialog : public QDialog {
   /// Create a nogood dialog with nogoods for selected nodes
   NogoodDialog(QWidget* parent, TreeCanvas& tc,
                const std::vector<int>& selected,
-               const std::unordered_map<int64_t, std::string>& sid2nogood);
+               const BlobStore& sid2nogood);
 
   ~NogoodDialog();
 };
@@ -1,8 +1,11 @@
 #include "profiler-conductor.hh"
 #include "profiler-tcp-server.hh"
+#include "profiler-local-server.hh"
+#include "ingest-reactor.hh"
 #include "gistmainwindow.h"
 #include "cmp_tree_dialog.hh"
 #include "data.hh"
+#include "execution.hh"
 
 #include "globalhelper.hh"
 #include "libs/perf_helper.hh"
@@ -12,6 +15,7 @@
 #include <google/protobuf/io/coded_stream.h>
 
 #include "message.pb.hh"
+#include "libs/delta_codec.hh"
 
 #include "ml-stats.hh"
 #include "webscript.hh"
@@ -19,6 +23,7 @@
 #include <fstream>
 
 #include <QPushButton>
+#include <QTimer>
 #include <QVBoxLayout>
 
 #include <thread>
@@ -56,11 +61,36 @@ using google::protobuf::io::IstreamInputStream;
 Execution* loadSaved(Execution* e, std::string path) {
   std::ifstream inputFile(path, std::ios::in | std::ios::binary);
   IstreamInputStream raw_input(&inputFile);
+  message::Node msg;
+  /// as on a connection, DELTA batches only after a START announcing them
+  auto encoding = message::Node::PLAIN;
+  bool reported_delta = false;
   while (true) {
-    message::Node msg;
     bool ok = readDelimitedFrom(&raw_input, &msg);
     if (!ok) break;
-    e->handleNewNode(msg);
+    switch (msg.type()) {
+    case message::Node::START:
+      encoding = msg.encoding();
+      break;
+    case message::Node::NODE:
+      e->handleNewNode(msg);
+      break;
+    case message::Node::NODE_BATCH:
+      if (msg.batch().sid_delta_size() > 0 && encoding != message::Node::DELTA) {
+        if (!reported_delta) {
+          qDebug() << "ignoring DELTA batches: START did not announce them";
+          reported_delta = true;
+        }
+        break;
+      }
+      e->handleNewBatch(*msg.mutable_batch());
+      break;
+    case message::Node::LABEL_DICT:
+      e->handleLabelDict(msg);
+      break;
+    default:
+      break;
+    }
   }
   e->doneReceiving();
   return e;
@@ -79,6 +109,11 @@ ProfilerConductor::ProfilerConductor() : QMainWindow() {
   executionList = new QListWidget;
   executionList->setSelectionMode(QAbstractItemView::MultiSelection);
 
+  /// keeps the memory figures in the list up to date
+  QTimer* listTimer = new QTimer(this);
+  connect(listTimer, SIGNAL(timeout()), this, SLOT(updateList()));
+  listTimer->start(LIST_UPDATE_MS);
+
   QPushButton* gistButton = new QPushButton("show tree");
   connect(gistButton, SIGNAL(clicked(bool)), this,
           SLOT(gistButtonClicked(bool)));
@@ -133,11 +168,27 @@ ProfilerConductor::ProfilerConductor() : QMainWindow() {
 
   centralWidget->setLayout(layout);
 
+  ingest_pool.reset(new IngestPool(
+      GlobalParser::value(GlobalParser::ingest_threads).toInt(),
+      GlobalParser::value(GlobalParser::decode_threads).toInt()));
+
   // Listen for new executions.
   ProfilerTcpServer* listener = new ProfilerTcpServer(this);
   listener->listen(QHostAddress::Any, 6565);
+
+  // ... and for solvers running on this machine
+  auto socket_name = GlobalParser::value(GlobalParser::local_socket_option);
+  QLocalServer::removeServer(socket_name);
+  ProfilerLocalServer* local_listener = new ProfilerLocalServer(this);
+  if (local_listener->listen(socket_name)) {
+    qDebug() << "listening on" << local_listener->fullServerName();
+  } else {
+    qDebug() << "can't listen on local socket" << socket_name;
+  }
 }
 
+ProfilerConductor::~ProfilerConductor() = default;
+
 class ExecutionListItem : public QListWidgetItem {
  public:
   ExecutionListItem(Execution* execution, QListWidget* parent, int type = Type)
@@ -164,10 +215,28 @@ void ProfilerConductor::newExecution(Execution* execution) {
           SLOT(onSomeFinishedBuilding()));
 }
 
+static QString megabytes(size_t bytes) {
+  return QString::number(bytes / double(1 << 20), 'f', 1) + " MB";
+}
+
 void ProfilerConductor::updateList(void) {
   for (int i = 0; i < executions.size(); i++) {
-    executionList->item(i)
-        ->setText(QString::fromStdString(executions[i]->getTitle()));
+    const MemoryUsage usage = executions[i]->memoryUsage();
+
+    QListWidgetItem* item = executionList->item(i);
+    item->setText(QString::fromStdString(executions[i]->getTitle()) + "  (" +
+                  megabytes(usage.total()) + ")");
+    item->setToolTip(
+        "entries: " + megabytes(usage.entries) +
+        "\nnogoods: " + megabytes(usage.nogoods) +
+        "\ninfo: " + megabytes(usage.info) +
+        "\nindexes: " + megabytes(usage.indexes) +
+        "\n(mapped from file: " + megabytes(usage.mapped) + ")" +
+        "\nnodes: " + megabytes(usage.nodes) +
+        "\nchild arrays: " + megabytes(usage.children) +
+        "\nshapes: " + megabytes(usage.shapes) +
+        "\npixel trees: " + megabytes(usage.views) +
+        "\nlabels (all executions): " + megabytes(usage.labels));
   }
 }
 
@@ -348,6 +417,20 @@ void ProfilerConductor::onSomeFinishedBuilding() {
     }
   }
 
+  if (GlobalParser::isSet(GlobalParser::save_execution)) {
+    if (executions.size() == 1) {
+      auto item = static_cast<ExecutionListItem*>(executionList->item(0));
+      auto file_name = GlobalParser::value(GlobalParser::save_execution);
+      saveExecution(item->execution_, file_name.toStdString());
+    }
+  }
+
+  if (GlobalParser::isSet(GlobalParser::test_option)) {
+    qDebug() << "test mode, terminate";
+    qApp->exit();
+    return;
+  }
+
   if (GlobalParser::isSet(GlobalParser::auto_stats)) {
     if (executions.size() == 1) {
       auto item = static_cast<ExecutionListItem*>(executionList->item(0));
@@ -391,38 +474,81 @@ void ProfilerConductor::saveExecutionClicked(bool) {
 
   QString filename =
       QFileDialog::getSaveFileName(this, "Save execution", QDir::currentPath());
-  std::ofstream outputFile(filename.toStdString(),
-                           std::ios::out | std::ios::binary);
+  if (!filename.isNull())
+      saveExecution(item->execution_, filename.toStdString());
+}
+
+void ProfilerConductor::saveExecution(Execution* execution, std::string filename) {
+  std::ofstream outputFile(filename, std::ios::out | std::ios::binary);
   OstreamOutputStream raw_output(&outputFile);
-  Data* data = item->execution_->getData();
+  Data* data = execution->getData();
+
+  /// Saved as DELTA-encoded batches, labels declared once
+  static constexpr int SAVE_BATCH_SIZE = 4096;
+
+  message::Node start;
+  start.set_type(message::Node::START);
+  start.set_encoding(message::Node::DELTA);
+  writeDelimitedTo(start, &raw_output);
+
+  delta_codec::Encoder<message::NodeBatch> encoder;
+  std::unordered_map<int, int> file_labels;  /// table id -> id in the file
+  message::Node dict;
+  dict.set_type(message::Node::LABEL_DICT);
+  message::Node msg;
+  msg.set_type(message::Node::NODE_BATCH);
+  auto batch = msg.mutable_batch();
+
+  auto flush = [&]() {
+    if (dict.labels_size() > 0) {
+      writeDelimitedTo(dict, &raw_output);
+      dict.clear_labels();
+    }
+    encoder.encode(*batch);
+    writeDelimitedTo(msg, &raw_output);
+    batch->Clear();
+  };
+
+  /// in gid order
+  for (int gid = 0; gid < data->gid2entry.size(); ++gid) {
+    DbEntry entry = data->getEntry(gid);
+    if (!entry) continue;
+    const int i = batch->sid_size();
+    batch->add_sid(entry.s_node_id());
+    batch->add_pid(entry.parent_sid());
+    batch->add_alt(entry.alt());
+    batch->add_kids(entry.numberOfKids());
+    batch->add_status(entry.status());
+    batch->add_restart_id(entry.restart_id());
+    batch->add_time(entry.time_stamp());
+    batch->add_thread_id(entry.thread_id());
+    batch->add_domain_size(entry.domain());
+    batch->add_decision_level(entry.decision_level());
+
+    auto label = file_labels.find(entry.label_id());
+    if (label == file_labels.end()) {
+      const int id = file_labels.size();
+      if (dict.labels_size() == 0) dict.set_first_label_id(id);
+      dict.add_labels(Data::labelOf(entry));
+      label = file_labels.emplace(entry.label_id(), id).first;
+    }
+    batch->add_label_id(label->second);
 
-  std::vector<unsigned int> keys;
-  for (auto it = data->gid2entry.begin(); it != data->gid2entry.end(); it++) {
-    keys.push_back(it->first);
-  }
-  sort(keys.begin(), keys.end());
-
-  for (auto it = keys.begin(); it != keys.end(); it++) {
-    DbEntry* entry = data->gid2entry[*it];
-    message::Node node;
-    node.set_type(message::Node::NODE);
-    node.set_sid(entry->s_node_id);
-    node.set_pid(entry->parent_sid);
-    node.set_alt(entry->alt);
-    node.set_kids(entry->numberOfKids);
-    node.set_status(static_cast<message::Node::NodeStatus>(entry->status));
-    //            node.set_restart_id
-    node.set_time(entry->time_stamp);
-    node.set_thread_id(entry->thread_id);
-    node.set_label(entry->label);
-    node.set_domain_size(entry->domain);
     //            node.set_solution(entry->);
-    auto ngit = data->getNogoods().find(entry->s_node_id);
-    if (ngit != data->getNogoods().end()) node.set_nogood(ngit->second);
-    auto infoit = data->sid2info.find(entry->s_node_id);
-    if (infoit != data->sid2info.end()) node.set_info(*infoit->second);
-    writeDelimitedTo(node, &raw_output);
+    auto nogood = data->getNogoods().get(entry.full_sid());
+    if (!nogood.empty()) {
+      batch->add_nogood_idx(i);
+      batch->add_nogood(nogood);
+    }
+    auto info = data->getInfo().get(entry.full_sid());
+    if (!info.empty()) {
+      batch->add_info_idx(i);
+      batch->add_info(info);
+    }
+
+    if (batch->sid_size() == SAVE_BATCH_SIZE) flush();
   }
+  if (batch->sid_size() > 0) flush();
 }
 
 void ProfilerConductor::loadExecutionClicked(bool) {
@@ -438,7 +564,7 @@ void ProfilerConductor::loadExecution(std::string filename) {
   Execution* e = new Execution();
   newExecution(e);
   /// TODO(maxim): should somehow know if it was restarts, TRUE for now
-  e->start("loaded from " + filename, true);
+  e->startLoading("loaded from " + filename, true);
   loadSaved(e, filename);
 }
 
@@ -3,11 +3,13 @@
 
 #include <QListWidget>
 #include <QMainWindow>
+#include <memory>
 
 class Execution;
 class QCheckBox;
 class WebscriptView;
 class GistMainWindow;
+class IngestPool;
 
 class ExecutionInfo {
 public:
@@ -32,6 +34,12 @@ class ProfilerConductor : public QMainWindow {
 
   QListWidget* executionList;
   QCheckBox* compareWithLabelsCB;
+
+  /// Threads receiving from all solver connections
+  std::unique_ptr<IngestPool> ingest_pool;
+
+  /// how often the list (with memory figures) is refreshed
+  static constexpr int LIST_UPDATE_MS = 1000;
  private slots:
   void gistButtonClicked(bool checked);
   void compareButtonClicked(bool checked);
@@ -44,8 +52,12 @@ class ProfilerConductor : public QMainWindow {
 
  public:
   ProfilerConductor();
+  ~ProfilerConductor();
+  IngestPool& ingestPool() { return *ingest_pool; }
   void newExecution(Execution* execution);
   void loadExecution(std::string filename);
+  /// Write the entries of `execution` (in gid order) to `filename`
+  void saveExecution(Execution* execution, std::string filename);
   void compareExecutions(bool auto_save);
 
   void registerWebscriptView(Execution* execution, std::string id, WebscriptView* webView);
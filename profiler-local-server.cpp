@@ -0,0 +1,17 @@
+#include "profiler-local-server.hh"
+#include "receiver.hh"
+#include "ingest-reactor.hh"
+#include "profiler-conductor.hh"
+
+#include "execution.hh"
+
+ProfilerLocalServer::ProfilerLocalServer(ProfilerConductor* parent)
+    : QLocalServer{parent}, _conductor{*parent} {}
+
+void ProfilerLocalServer::incomingConnection(quintptr socketDescriptor) {
+  Execution* execution = new Execution();
+
+  _conductor.newExecution(execution);
+
+  _conductor.ingestPool().add(new ExecutionReceiver(socketDescriptor, execution));
+}
@@ -0,0 +1,24 @@
+#ifndef PROFILER_LOCAL_SERVER_HH
+#define PROFILER_LOCAL_SERVER_HH
+
+#include <QLocalServer>
+
+class ProfilerConductor;
+
+/// Accepts solvers running on the same machine through a Unix domain
+/// socket; such solvers may also send their nodes through a shared memory
+/// ring (see libs/local_connector.hh)
+class ProfilerLocalServer : public QLocalServer {
+  Q_OBJECT
+
+ public:
+  ProfilerLocalServer(ProfilerConductor* parent);
+
+ protected:
+  void incomingConnection(quintptr socketDescriptor) override;
+
+ private:
+  ProfilerConductor& _conductor;
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include "profiler-tcp-server.hh"
-#include "receiverthread.hh"
+#include "receiver.hh"
+#include "ingest-reactor.hh"
 #include "profiler-conductor.hh"
 
 #include "execution.hh"
@@ -10,11 +11,7 @@ ProfilerTcpServer::ProfilerTcpServer(ProfilerConductor* parent)
 void ProfilerTcpServer::incomingConnection(qintptr socketDescriptor) {
   Execution* execution = new Execution();
 
-  /// TODO(maxim): receiver should be destroyed when done
-  ReceiverThread* receiver =
-      new ReceiverThread(socketDescriptor, execution, this);
-
   _conductor.newExecution(execution);
 
-  receiver->start();
+  _conductor.ingestPool().add(new ExecutionReceiver(socketDescriptor, execution));
 }
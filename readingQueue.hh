@@ -22,51 +22,51 @@
 #ifndef READING_QUEUE
 #define READING_QUEUE
 
+#include <cstdint>
+#include <unordered_map>
 #include <vector>
-#include <map>
-#include <queue>
-#include "readingQueue.hh"
 
-class DbEntry;
-
-typedef std::map<int, std::queue<DbEntry*>*> QueueMap;
+class EntryColumns;
 
+/// Decides which entry the builder reads next.  Entries are read in the
+/// order they were received; one whose parent is not in the tree yet is
+/// put aside under its parent's (full) solver id, and read again as soon
+/// as that parent is inserted.  Entries are given by their array ids.
 class ReadingQueue {
  private:
-  /// nodes from Data
-  const std::vector<DbEntry*>& nodes_arr;
-
-  /// nodes delayed, map: thread_id -> queue
-  QueueMap delayed_treads;
-  QueueMap::iterator it;
+  /// nodes from Data, or just those in `aids`
+  const EntryColumns* nodes_arr = nullptr;
+  const std::vector<int>* aids = nullptr;
 
-  unsigned last_read = 0;    /// node id from nodes_arr currently read
-  int delayed_count = 0;     /// how many nodes delayed
-  int delayed_cd_count = 0;  /// if zero, read delayed again
-  const int DELAYED_CD = 1;  /// delayed cooldown
+  unsigned last_read = 0;  /// node id from nodes_arr currently read
 
-  /// how many nodes tried until success;
-  /// increment if failed
-  /// refresh on success
-  int node_misses = 0;
+  /// parent full sid -> children waiting for it
+  std::unordered_map<int64_t, std::vector<int>> orphans;
+  int orphan_count = 0;
 
-  bool read_delayed = false;
-
-  inline QueueMap::iterator nextNonemptyIt(QueueMap::iterator it);
+  /// children whose parent has been inserted, not read again yet
+  std::vector<int> released;
 
  public:
-  explicit ReadingQueue(const std::vector<DbEntry*>& nodes);
+  explicit ReadingQueue(const EntryColumns& nodes);
+  /// Read only the entries `aids` (in that order)
+  explicit ReadingQueue(const std::vector<int>& aids);
+
+  /// The next entry to read; `delayed` tells whether it was put aside
+  /// before (and so is not read for the first time)
+  int next(bool& delayed);
 
-  DbEntry* next(bool& delayed);
+  /// whether there are unread entries or released children
+  bool canRead() const;
 
-  /// whether nodes_arr is processed and all queues are empty
-  bool canRead();
+  /// Put aside entry `aid` until `parent_sid` is inserted
+  void readLater(int aid, int64_t parent_sid);
 
-  /// notify regarding last processed entry
-  void update(bool success);
+  /// Entry `sid` is in the tree: release its waiting children
+  void inserted(int64_t sid);
 
-  /// put into delayed queue
-  void readLater(DbEntry* delayed);
+  /// how many entries are waiting for their parent
+  int orphanCount() const { return orphan_count; }
 };
 
-#endif
\ No newline at end of file
+#endif
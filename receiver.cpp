@@ -0,0 +1,154 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "receiver.hh"
+#include "execution.hh"
+#include "globalhelper.hh"
+#include "message.pb.hh"
+
+#include <QDebug>
+#include <algorithm>
+
+ExecutionReceiver::ExecutionReceiver(int fd, Execution* execution)
+    : IngestConnection(fd), execution(execution) {
+    max_backlog = GlobalParser::value(GlobalParser::max_backlog).toInt();
+    credit_window =
+        std::max(GlobalParser::value(GlobalParser::credit_window).toInt(), 1);
+}
+
+bool
+ExecutionReceiver::throttled()
+{
+    if (max_backlog <= 0) return false;
+
+    const int backlog = execution->getBacklog();
+    if (paused) {
+        paused = backlog > max_backlog / 2;
+    } else if (backlog > max_backlog) {
+        paused = true;
+        qDebug() << "builder backlog of" << backlog << "nodes, pausing receiver";
+    }
+    return paused;
+}
+
+void
+ExecutionReceiver::tick()
+{
+    sendCredit(false);
+}
+
+// The credit is cumulative (a total number of nodes), so a lost or late
+// update does no harm and the solver simply takes the largest one seen.
+// It follows the builder rather than the receiver, so a solver honouring
+// it never gets more than credit_window nodes ahead of the tree.
+void
+ExecutionReceiver::sendCredit(bool force)
+{
+    long long next = execution->getNodesRead() + credit_window;
+    if (!force && next - credit < credit_window / 4) return;
+
+    message::Node msg;
+    msg.set_type(message::Node::CREDIT);
+    msg.set_credit(next);
+    sendMessage(msg);
+    credit = next;
+}
+
+// Called on the reactor thread.  The startReceiving/doneReceiving signals
+// are delivered from the GUI thread, as they were when each connection had
+// its own ReceiverThread.
+void
+ExecutionReceiver::handleMessage(message::Node& msg1)
+{
+    // std::cerr << "message type: " << msg1.type() << "\n";
+
+    switch (msg1.type()) {
+    case message::Node::NODE:
+        execution->handleNewNode(msg1);
+        break;
+    case message::Node::NODE_BATCH:
+        if (msg1.batch().sid_delta_size() > 0 &&
+            encoding != message::Node::DELTA) {
+            if (!reported_delta) {
+                qDebug() << "ignoring DELTA batches: START did not announce them";
+                reported_delta = true;
+            }
+            break;
+        }
+        execution->handleNewBatch(*msg1.mutable_batch());
+        break;
+    case message::Node::LABEL_DICT:
+        execution->handleLabelDict(msg1);
+        break;
+    case message::Node::START:
+    {
+        // qDebug() << "START RECEIVING: " << msg1.label().c_str();
+
+        if (msg1.has_info()) {
+            execution->setVariableListString(msg1.info());
+        }
+
+        if (msg1.restart_id() != -1 && msg1.restart_id() != 0) {
+            // qDebug() << ">>> restart and continue";
+            break;
+        }
+
+        bool is_restarts = (msg1.restart_id() != -1);
+
+        qDebug() << "is_restarts: " << is_restarts;
+
+        execution->start(msg1.label(), is_restarts);
+        QMetaObject::invokeMethod(execution, "startReceiving", Qt::QueuedConnection);
+
+        encoding = msg1.encoding();
+        if (encoding == message::Node::DELTA) {
+            qDebug() << "receiving delta-encoded batches";
+        }
+
+        if (msg1.flow_control()) {
+            flow_control = true;
+            sendCredit(true);
+        }
+    }
+    break;
+    case message::Node::DONE:
+        // qDebug() << "received DONE SENDING";
+        done = true;
+        QMetaObject::invokeMethod(execution, "doneReceiving", Qt::QueuedConnection);
+        break;
+    default:
+        break;
+    }
+}
+
+void
+ExecutionReceiver::onReceived(std::chrono::steady_clock::time_point when)
+{
+    execution->setReceiveTime(when);
+}
+
+void
+ExecutionReceiver::onClosed()
+{
+    if (!done) {
+        QMetaObject::invokeMethod(execution, "doneReceiving", Qt::QueuedConnection);
+    }
+}
@@ -0,0 +1,69 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef RECEIVER_HH
+#define RECEIVER_HH
+
+#include "ingest-reactor.hh"
+
+class Execution;
+
+/// Feeds the messages of one solver connection into its Execution
+class ExecutionReceiver : public IngestConnection {
+ public:
+  ExecutionReceiver(int fd, Execution* execution);
+
+  bool throttled() override;
+  void tick() override;
+  bool needsTicks() const override { return flow_control && !done; }
+
+ protected:
+  void handleMessage(message::Node& msg) override;
+  void onReceived(std::chrono::steady_clock::time_point when) override;
+  void onClosed() override;
+
+ private:
+  Execution* execution;
+  /// whether DONE has been received
+  bool done = false;
+
+  /// batch encoding announced in START; DELTA batches are ignored
+  /// unless it is DELTA
+  message::Node::Encoding encoding = message::Node::PLAIN;
+  /// whether an ignored DELTA batch was reported
+  bool reported_delta = false;
+
+  /// backlog (in nodes) at which reading stops; 0 for no limit.
+  /// Reading resumes once the backlog is down to half of it.
+  int max_backlog;
+  bool paused = false;
+
+  /// whether the solver asked for CREDIT messages in START
+  bool flow_control = false;
+  int credit_window;
+  /// the last credit sent
+  long long credit = 0;
+
+  /// send a new credit if it moved on enough (or if `force`)
+  void sendCredit(bool force);
+};
+
+#endif
@@ -0,0 +1,114 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef RING_BUFFER_HH
+#define RING_BUFFER_HH
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+#include <vector>
+
+/// Fixed-capacity byte ring used by the receivers to frame length-prefixed
+/// messages without moving the unread tail around.  Read and write positions
+/// grow monotonically and are masked into the buffer, so capacity is always
+/// a power of two.  The buffer only reallocates when a single frame does not
+/// fit, which does not happen in steady state.
+class RingBuffer {
+  std::vector<char> _buf;
+  uint64_t _mask;
+  uint64_t _read = 0;   /// total bytes consumed
+  uint64_t _write = 0;  /// total bytes committed
+
+  static uint64_t roundUp(uint64_t n) {
+    uint64_t cap = 1;
+    while (cap < n) cap <<= 1;
+    return cap;
+  }
+
+ public:
+  static constexpr uint64_t DEFAULT_CAPACITY = 1 << 20;
+
+  explicit RingBuffer(uint64_t capacity = DEFAULT_CAPACITY)
+      : _buf(roundUp(capacity)), _mask(_buf.size() - 1) {}
+
+  uint64_t capacity() const { return _buf.size(); }
+  /// number of unread bytes
+  uint64_t size() const { return _write - _read; }
+  uint64_t freeSpace() const { return capacity() - size(); }
+
+  /// Contiguous free region starting at the write position; data written
+  /// there becomes readable after `commit`.  Returns its length in `len`.
+  char* writeSpan(uint64_t& len) {
+    const uint64_t pos = _write & _mask;
+    len = std::min(freeSpace(), capacity() - pos);
+    return &_buf[pos];
+  }
+
+  void commit(uint64_t n) {
+    assert(n <= freeSpace());
+    _write += n;
+  }
+
+  /// The next `n` unread bytes as (at most) two contiguous spans;
+  /// `len2` is zero unless the bytes wrap around the end of the buffer.
+  void readSpans(uint64_t n, const char*& p1, uint64_t& len1,
+                 const char*& p2, uint64_t& len2) const {
+    assert(n <= size());
+    const uint64_t pos = _read & _mask;
+    len1 = std::min(n, capacity() - pos);
+    len2 = n - len1;
+    p1 = &_buf[pos];
+    p2 = &_buf[0];
+  }
+
+  /// Copy the next `n` unread bytes into `out` without consuming them
+  void peek(char* out, uint64_t n) const {
+    const char *p1, *p2;
+    uint64_t len1, len2;
+    readSpans(n, p1, len1, p2, len2);
+    std::memcpy(out, p1, len1);
+    if (len2 > 0) std::memcpy(out + len1, p2, len2);
+  }
+
+  void consume(uint64_t n) {
+    assert(n <= size());
+    _read += n;
+    /// rewind when empty so that the next frames are more likely contiguous
+    if (_read == _write) _read = _write = 0;
+  }
+
+  /// Grow so that at least `n` bytes fit; unread bytes are linearised
+  /// at the front of the new buffer.
+  void reserve(uint64_t n) {
+    if (n <= capacity()) return;
+    std::vector<char> bigger(roundUp(n));
+    const uint64_t used = size();
+    peek(bigger.data(), used);
+    _buf.swap(bigger);
+    _mask = _buf.size() - 1;
+    _read = 0;
+    _write = used;
+  }
+};
+
+#endif
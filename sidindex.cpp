@@ -0,0 +1,109 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "sidindex.hh"
+
+#include <algorithm>
+
+/// How far past the pages and restarts seen so far an id may be and
+/// still get a dense slot; further ones are kept in the hash map
+static constexpr size_t DENSE_SLACK = 64;
+
+static bool isDense(size_t index, size_t size) {
+    return index < size * 2 + DENSE_SLACK;
+}
+
+/// the table of a restart; restart -1 (no restarts) comes first
+static int64_t tableOf(int32_t restart_id) {
+    return static_cast<int64_t>(restart_id) + 1;
+}
+
+int* SidIndex::denseSlot(int32_t restart_id, int32_t sid) {
+    const int64_t table = tableOf(restart_id);
+    if (table < 0 || sid < 0) return nullptr;
+
+    if (static_cast<size_t>(table) >= restarts.size()) {
+        if (!isDense(table, restarts.size())) return nullptr;
+        restarts.resize(table + 1);
+    }
+
+    auto& pages = restarts[table];
+    const size_t page = static_cast<size_t>(sid) >> PAGE_BITS;
+
+    if (page >= pages.size()) {
+        if (!isDense(page, pages.size())) return nullptr;
+        pages.resize(page + 1);
+    }
+
+    if (!pages[page]) {
+        pages[page].reset(new int[PAGE_SIZE]);
+        std::fill(pages[page].get(), pages[page].get() + PAGE_SIZE, -1);
+    }
+
+    return &pages[page][sid & (PAGE_SIZE - 1)];
+}
+
+int SidIndex::find(int64_t full_sid) const {
+    const int32_t sid = static_cast<int32_t>(full_sid);
+    const int32_t restart_id = static_cast<int32_t>(full_sid >> 32);
+
+    const int64_t table = tableOf(restart_id);
+
+    if (table >= 0 && sid >= 0 &&
+        static_cast<size_t>(table) < restarts.size()) {
+        const auto& pages = restarts[table];
+        const size_t page = static_cast<size_t>(sid) >> PAGE_BITS;
+        if (page < pages.size() && pages[page]) {
+            const int aid = pages[page][sid & (PAGE_SIZE - 1)];
+            if (aid != -1) return aid;
+        }
+    }
+
+    if (sparse.empty()) return -1;
+    auto it = sparse.find(full_sid);
+    return it == sparse.end() ? -1 : it->second;
+}
+
+void SidIndex::insert(int64_t full_sid, int aid) {
+    const int32_t sid = static_cast<int32_t>(full_sid);
+    const int32_t restart_id = static_cast<int32_t>(full_sid >> 32);
+
+    int* dense = denseSlot(restart_id, sid);
+    if (dense) {
+        *dense = aid;
+    } else {
+        sparse[full_sid] = aid;
+    }
+}
+
+size_t SidIndex::bytes() const {
+    size_t total = restarts.capacity() * sizeof(restarts[0]);
+    for (const auto& pages : restarts) {
+        total += pages.capacity() * sizeof(Page);
+        for (const auto& page : pages) {
+            if (page) total += PAGE_SIZE * sizeof(int);
+        }
+    }
+    /// roughly one node per element plus the bucket array
+    total += sparse.size() * (sizeof(std::pair<int64_t, int>) + 2 * sizeof(void*)) +
+             sparse.bucket_count() * sizeof(void*);
+    return total;
+}
@@ -0,0 +1,68 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef SID_INDEX_HH
+#define SID_INDEX_HH
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/// Maps full solver ids (restart_id << 32 | sid) to array ids.
+///
+/// Solvers number the nodes of a restart densely from zero, so every
+/// restart gets a direct-indexed table: pages of PAGE_SIZE array ids,
+/// allocated as the sids reach them and never moved, so growing the
+/// table does not copy it.  Searches without restarts send restart_id
+/// -1, so that one has a table too (tables are indexed by restart_id
+/// + 1).  Ids far beyond what was seen so far (negative, or with big
+/// gaps) go to a hash map instead.
+class SidIndex {
+public:
+    static constexpr int PAGE_BITS = 12;
+    static constexpr int PAGE_SIZE = 1 << PAGE_BITS;
+
+    /// Array id of `full_sid`, -1 if there is none
+    int find(int64_t full_sid) const;
+
+    /// Set the array id of `full_sid` (replacing the previous one)
+    void insert(int64_t full_sid, int aid);
+
+    /// Number of ids kept in the hash map
+    size_t sparseSize() const { return sparse.size(); }
+
+    /// Bytes taken by the tables
+    size_t bytes() const;
+
+private:
+    using Page = std::unique_ptr<int[]>;
+
+    /// restart_id + 1 -> pages -> array ids (-1 for missing sids)
+    std::vector<std::vector<Page>> restarts;
+
+    std::unordered_map<int64_t, int> sparse;
+
+    /// the dense slot of a sid, created if needed; null for outliers
+    int* denseSlot(int32_t restart_id, int32_t sid);
+};
+
+#endif
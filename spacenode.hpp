@@ -125,8 +125,9 @@ SpaceNode::getAlternative(const NodeAllocator& na) const {
   SpaceNode* p = getParent(na);
   if (p == nullptr)
     return -1;
+  const int self = getIndex(na);
   for (int i=p->getNumberOfChildren(); i--;)
-    if (p->getChild(na,i) == this)
+    if (p->getChild(i) == self)
       return i;
   GECODE_NEVER;
   return -1;
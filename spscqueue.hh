@@ -0,0 +1,100 @@
+/*  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef SPSC_QUEUE_HH
+#define SPSC_QUEUE_HH
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/// Bounded lock-free queue between exactly one producer thread and one
+/// consumer thread.  Like RingBuffer, positions grow monotonically and are
+/// masked into the slots, so the capacity is a power of two.
+///
+/// Items are swapped in and out of their slots rather than copied: with
+/// T = a struct holding a vector, the vectors travel back and forth with
+/// their capacity and steady-state traffic does not allocate.
+template <typename T>
+class SpscQueue {
+  std::vector<T> _slots;
+  const size_t _mask;
+
+  /// the consumer's position and its last look at _tail
+  std::atomic<size_t> _head{0};
+  size_t _tail_seen = 0;
+  char _pad1[64];
+
+  /// the producer's position and its last look at _head
+  std::atomic<size_t> _tail{0};
+  size_t _head_seen = 0;
+  char _pad2[64];
+
+  static size_t roundUp(size_t n) {
+    size_t cap = 1;
+    while (cap < n) cap <<= 1;
+    return cap;
+  }
+
+ public:
+  explicit SpscQueue(size_t capacity)
+      : _slots(roundUp(capacity)), _mask(_slots.size() - 1) {}
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  size_t capacity() const { return _slots.size(); }
+
+  /// Number of queued items; exact only on the producer or consumer thread
+  size_t size() const {
+    return _tail.load(std::memory_order_acquire) -
+           _head.load(std::memory_order_acquire);
+  }
+
+  /// Producer: swap `item` into the queue; `item` gets what the slot held
+  /// before.  Returns false (and leaves `item` alone) if the queue is full.
+  bool push(T& item) {
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail - _head_seen == _slots.size()) {
+      _head_seen = _head.load(std::memory_order_acquire);
+      if (tail - _head_seen == _slots.size()) return false;
+    }
+    std::swap(_slots[tail & _mask], item);
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Consumer: swap the oldest item into `item` (the slot keeps the old
+  /// contents of `item`).  Returns false if the queue is empty.
+  bool pop(T& item) {
+    const size_t head = _head.load(std::memory_order_relaxed);
+    if (head == _tail_seen) {
+      _tail_seen = _tail.load(std::memory_order_acquire);
+      if (head == _tail_seen) return false;
+    }
+    std::swap(_slots[head & _mask], item);
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+};
+
+#endif
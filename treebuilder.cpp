@@ -23,9 +23,17 @@
 #include "globalhelper.hh"
 #include "libs/perf_helper.hh"
 #include "readingQueue.hh"
+#include "third-party/json.hpp"
 #include <cassert>
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <unordered_map>
+
 #include <time.h>
+#include <sys/resource.h>
 #include <sys/time.h>
 
 double get_wall_time() {
@@ -40,10 +48,11 @@ double get_wall_time() {
 TreeBuilder::TreeBuilder(Execution* execution_, QObject* parent)
     : QThread(parent),
       _na(execution_->getNA()),
-      execution(execution_) {
+      execution(execution_),
+      read_queue(new ReadingQueue(execution_->getData()->getColumns())),
+      tree(_na, *read_queue, execution_->getStatistics(), false) {
 
   _data = execution->getData();
-  read_queue.reset(new ReadingQueue(_data->getEntries()));
 
   qDebug() << "starting TreeBuilder on execution" << execution;
     
@@ -60,131 +69,131 @@ void TreeBuilder::initRoot(int kids, NodeStatus status) {
 
   root->dirtyUp(_na);
 
-  emit addedNode();
+  emit addedNodes(1);
 }
 
 TreeBuilder::~TreeBuilder() {}
 
 void TreeBuilder::setDoneReceiving() { _data->setDoneReceiving(); }
 
-bool TreeBuilder::processRoot(DbEntry& dbEntry) {
-  QMutexLocker locker(&execution->getMutex());
-  QMutexLocker layoutLocker(&execution->getLayoutMutex());
-
+bool TreeBuilder::processRoot(DbEntry dbEntry, Shard& shard) {
+#ifdef MAXIM_DEBUG
   std::cerr << "process root: " << dbEntry << "\n";
+#endif
 
-  auto& gid2entry = _data->gid2entry;
-
-  Statistics& stats = execution->getStatistics();
-
-  stats.choices++;
+  NodeAllocator& na = shard.na;
+  Statistics& stats = shard.stats;
 
   // can be a real root, or one of initial nodes in restarts
   VisualNode* root = nullptr;
 
-  int kids = dbEntry.numberOfKids;
+  int kids = dbEntry.numberOfKids();
+
+  if (shard.local) {
+    /// the restart's own tree; buildRestarts hangs it off the super root
+    /// (and never gives a shard a second root)
+    if (na.size() > 0) {
+      shard.ignored.push_back(dbEntry);
+      return true;
+    }
+    root = na[na.allocateRoot()];
+    root->_tid = dbEntry.thread_id();
 
-  if (execution->isRestarts()) {
+    dbEntry.set_gid(0);
+    dbEntry.set_depth(2);
+  } else if (execution->isRestarts()) {
     int restart_root =
-        (_na)[0]->addChild(_na);  // create a node for a new root
-    root = (_na)[restart_root];
-    root->_tid = dbEntry.thread_id;
+        na[0]->addChild(na);  // create a node for a new root
+    root = na[restart_root];
+    root->_tid = dbEntry.thread_id();
 
     // The "super root" now has an extra child, so its children
     // haven't been laid out yet.
-    (_na)[0]->setChildrenLayoutDone(false);
+    na[0]->setChildrenLayoutDone(false);
 
     // The "super root" is effectively a branch node.
-    (_na)[0]->setStatus(BRANCH);
+    na[0]->setStatus(BRANCH);
     
-    dbEntry.gid = restart_root;
-    dbEntry.depth = 2;
+    dbEntry.set_gid(restart_root);
+    dbEntry.set_depth(2);
   } else {
-    root = (_na)[0];  // use the root that is already there
+    root = na[0];  // use the root that is already there
     root->_tid = 0;
-    dbEntry.gid = 0;
-    dbEntry.depth = 1;
+    dbEntry.set_gid(0);
+    dbEntry.set_depth(1);
   }
   // Assume the solver sends this.
   // dbEntry.decisionLevel = 0;
 
-  gid2entry[dbEntry.gid] = &dbEntry;
+  stats.choices++;
+
+  connectEntry(shard, dbEntry.gid(), dbEntry);
+  shard.queue.inserted(dbEntry.full_sid());
 
   /// setNumberOfChildren
-  root->setNumberOfChildren(kids, _na);
+  root->setNumberOfChildren(kids, na);
   root->setStatus(BRANCH);
   root->setHasSolvedChildren(false);
   root->setHasOpenChildren(true);
 
   stats.undetermined += kids - 1;
 
-  root->dirtyUp(_na);
-
-  emit addedRoot();
-  emit addedNode();
+  /// in bulk mode, the canvas hears about the roots once the tree is done
+  if (!bulk) emit addedRoot();
+  nodeAdded(shard, *root);
 
   return true;
 }
 
-bool TreeBuilder::processNode(DbEntry& dbEntry, bool is_delayed) {
-  QMutexLocker locker(&execution->getMutex());
-  QMutexLocker layoutLocker(&execution->getLayoutMutex());
-
-  int64_t pid = dbEntry.parent_sid;  /// parent ID as it comes from Solver
-  int alt = dbEntry.alt;             /// which alternative the current node is
-  int nalt = dbEntry.numberOfKids;   /// number of kids in current node
-  int status = dbEntry.status;
+bool TreeBuilder::processNode(DbEntry dbEntry, Shard& shard) {
+  int64_t pid = dbEntry.parent_sid();  /// parent ID as it comes from Solver
+  int alt = dbEntry.alt();             /// which alternative the current node is
+  int nalt = dbEntry.numberOfKids();   /// number of kids in current node
+  int status = dbEntry.status();
 
-  Statistics& stats = execution->getStatistics();
+  NodeAllocator& na = shard.na;
+  Statistics& stats = shard.stats;
 
-  const auto& sid2aid = _data->sid2aid;
-  
   /// find out if node exists
-  auto pid_it = sid2aid.find(pid);
-
-  if (pid_it == sid2aid.end()) {
-    if (!is_delayed) read_queue->readLater(&dbEntry);
+  const int parent_aid = _data->sid2aid.find(pid);
 
+  if (parent_aid == -1) {
+    shard.queue.readLater(dbEntry.aid(), pid);
     return false;
   }
 
-  const DbEntry& parentEntry = *_data->getEntries()[pid_it->second];
+  const DbEntry parentEntry = _data->entryAt(parent_aid);
   /// parent ID as it is in Node Allocator (Gist)
-  int parent_gid = parentEntry.gid;  
+  int parent_gid = parentEntry.gid();
 
   /// put delayed also if parent node hasn't been processed yet:
   if (parent_gid == -1) {
     // qDebug() << "parent arrived, but has not been processed yet";
-
-    if (!is_delayed)
-      read_queue->readLater(&dbEntry);
-    else
-      qDebug() << "node already in the queue";
-
+    shard.queue.readLater(dbEntry.aid(), pid);
     return false;
   }
 
-  VisualNode& parent = *(_na)[parent_gid];
+  VisualNode& parent = *na[parent_gid];
 
   assert(parent_gid >= 0);
   if (parent_gid < 0) {
     // qDebug() << "Ignoring a node: " << ignored_entries.size();
-    ignored_entries.push_back(&dbEntry);
+    shard.ignored.push_back(dbEntry);
     return false;
   }
 
-  VisualNode& node = *parent.getChild(_na, alt);
+  VisualNode& node = *parent.getChild(na, alt);
 
   /// Normal behaviour: insert into Undetermined
 
   if (node.getStatus() == UNDETERMINED) {
     stats.undetermined--;
 
-    int gid = node.getIndex(_na);  // node ID as it is in Gist
+    int gid = node.getIndex(na);  // node ID as it is in Gist
 
     /// fill in empty fields of dbEntry
-    dbEntry.gid = gid;
-    dbEntry.depth = parentEntry.depth + 1;  /// parent's depth + 1
+    dbEntry.set_gid(gid);
+    dbEntry.set_depth(parentEntry.depth() + 1);  /// parent's depth + 1
 
     // For now, assume that the solver sends the decision level.
 
@@ -196,12 +205,13 @@ bool TreeBuilder::processNode(DbEntry& dbEntry, bool is_delayed) {
     // dbEntry.decisionLevel =
     //     parentEntry.decisionLevel + (thisIsRightmost ? 0 : 1);
 
-    _data->gid2entry[gid] = &dbEntry;
+    connectEntry(shard, gid, dbEntry);
+    shard.queue.inserted(dbEntry.full_sid());
 
-    stats.maxDepth = std::max(stats.maxDepth, static_cast<int>(dbEntry.depth));
+    stats.maxDepth = std::max(stats.maxDepth, dbEntry.depth());
 
-    node._tid = dbEntry.thread_id;  /// TODO: tid should be in node's flags
-    node.setNumberOfChildren(nalt, _na);
+    node._tid = dbEntry.thread_id();  /// TODO: tid should be in node's flags
+    node.setNumberOfChildren(nalt, na);
 
     switch (status) {
       case FAILED:  // 1
@@ -209,7 +219,7 @@ bool TreeBuilder::processNode(DbEntry& dbEntry, bool is_delayed) {
         node.setHasSolvedChildren(false);
         node.setHasFailedChildren(true);
         node.setStatus(FAILED);
-        parent.closeChild(_na, true, false);
+        closeChild(shard, parent, true, false);
         stats.failures++;
 
         break;
@@ -220,7 +230,7 @@ bool TreeBuilder::processNode(DbEntry& dbEntry, bool is_delayed) {
         node.setHasSolvedChildren(false);
         node.setHasFailedChildren(true);
         node.setStatus(SKIPPED);
-        parent.closeChild(_na, true, false);
+        closeChild(shard, parent, true, false);
         stats.failures++;
         break;
       case SOLVED:  // 0
@@ -228,7 +238,7 @@ bool TreeBuilder::processNode(DbEntry& dbEntry, bool is_delayed) {
         node.setHasSolvedChildren(true);
         node.setHasOpenChildren(false);
         node.setStatus(SOLVED);
-        parent.closeChild(_na, false, true);
+        closeChild(shard, parent, false, true);
         stats.solutions++;
         break;
       case BRANCH:  // 2
@@ -242,8 +252,7 @@ bool TreeBuilder::processNode(DbEntry& dbEntry, bool is_delayed) {
         break;
     }
 
-    node.dirtyUp(_na);
-    emit addedNode();
+    nodeAdded(shard, node);
     // std::cerr << "TreeBuilder::processNode, normal case\n";
   } else {
     /// Not normal cases:
@@ -256,7 +265,7 @@ bool TreeBuilder::processNode(DbEntry& dbEntry, bool is_delayed) {
           node.setHasSolvedChildren(false);
           node.setHasFailedChildren(true);
           node.setStatus(FAILED);
-          parent.closeChild(_na, true, false);
+          closeChild(shard, parent, true, false);
           stats.failures++;
 
           break;
@@ -271,13 +280,12 @@ bool TreeBuilder::processNode(DbEntry& dbEntry, bool is_delayed) {
           assert(status != SOLVED);
           break;
       }
-      node.dirtyUp(_na);
-      emit addedNode();
+      nodeAdded(shard, node);
       // std::cerr << "TreeBuilder::processNode, not-normal case\n";
     } else {
       // qDebug() << "Ignoring a node: " << ignored_entries.size();
       // assert(status == SKIPPED);
-      ignored_entries.push_back(&dbEntry);
+      shard.ignored.push_back(dbEntry);
       /// sometimes branch wants to override branch
     }
   }
@@ -285,6 +293,98 @@ bool TreeBuilder::processNode(DbEntry& dbEntry, bool is_delayed) {
   return true;
 }
 
+void TreeBuilder::closeChild(Shard& shard, VisualNode& parent, bool failed,
+                             bool solved) {
+  if (!bulk) parent.closeChild(shard.na, failed, solved);
+}
+
+void TreeBuilder::nodeAdded(Shard& shard, VisualNode& node) {
+  if (!bulk) node.dirtyUp(shard.na);
+  ++shard.added;
+}
+
+void TreeBuilder::connectEntry(Shard& shard, int gid, DbEntry entry) {
+  /// a local gid is renumbered by buildRestarts first
+  if (!shard.local) _data->connectNodeToEntry(gid, entry);
+}
+
+void TreeBuilder::startBulk() {
+  bulk = true;
+  /// the entries were stored as they were read, so only building is timed
+  first_received = std::chrono::steady_clock::now();
+  start();
+}
+
+void TreeBuilder::appendBatch(const EntryBatch& batch) {
+  const int n = batch.entries.size();
+
+  peak_queue_depth = std::max(peak_queue_depth, _data->queueDepth() + n);
+  peak_lag = std::max(peak_lag, _data->receivedCount() - entriesRead());
+
+  int first;
+  {
+    QMutexLocker locker(&_data->dataMutex);
+    first = _data->appendEntries(batch.entries);
+  }
+
+  if (first == 0) first_received = batch.received;
+
+  int aid = (first + ARRIVAL_SAMPLE - 1) / ARRIVAL_SAMPLE * ARRIVAL_SAMPLE;
+  for (; aid < first + n; aid += ARRIVAL_SAMPLE) {
+    arrivals.emplace_back(aid, batch.received);
+  }
+}
+
+// For entries seen for the first time
+void TreeBuilder::sampleLatency(int aid) {
+  if (arrivals.empty() || arrivals.front().first != aid) return;
+
+  auto waited = std::chrono::steady_clock::now() - arrivals.front().second;
+  latencies.push_back(
+      std::chrono::duration_cast<std::chrono::microseconds>(waited).count());
+  arrivals.pop_front();
+}
+
+void TreeBuilder::reportIngest() const {
+  const int nodes = entries_read;
+  if (nodes == 0) return;
+
+  const double seconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - first_received).count();
+
+  std::vector<long long> sorted = latencies;
+  std::sort(sorted.begin(), sorted.end());
+  auto percentile = [&sorted](double p) -> double {
+    if (sorted.empty()) return 0;
+    size_t i = std::min(sorted.size() - 1, size_t(p * sorted.size()));
+    return sorted[i] / 1000.0;
+  };
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+  std::cerr << "ingest: " << nodes << " nodes in " << seconds << " s ("
+            << static_cast<long long>(nodes / seconds) << " nodes/s)\n"
+            << "receive-to-tree latency (ms): p50 " << percentile(0.5)
+            << ", p90 " << percentile(0.9) << ", p99 " << percentile(0.99)
+            << ", max " << percentile(1.0) << "\n"
+            << "peak queue depth: " << peak_queue_depth
+            << " entries, peak builder lag: " << peak_lag << " entries\n"
+            << "peak RSS: " << usage.ru_maxrss / 1024 << " MB\n"
+            << "restarts built in parallel: " << restarts_built << "\n";
+
+  /// one line of JSON, for scripts checking memory budgets
+  const MemoryUsage memory = execution->memoryUsage();
+  nlohmann::json report = {
+      {"entries", memory.entries},   {"labels", memory.labels},
+      {"nogoods", memory.nogoods},   {"info", memory.info},
+      {"indexes", memory.indexes},   {"mapped", memory.mapped},
+      {"nodes", memory.nodes},       {"children", memory.children},
+      {"shapes", memory.shapes},     {"views", memory.views},
+      {"total", memory.total()}};
+  std::cerr << "memory: " << report.dump() << "\n";
+}
+
 void TreeBuilder::run() {
 
   std::cerr << "TreeBuilder::run\n";
@@ -296,24 +396,68 @@ void TreeBuilder::run() {
   beginTime = get_wall_time();
   // qDebug() << "### in run method of tc:" << m_tc._id;
 
-  QMutex& dataMutex = _data->dataMutex;
-
   Statistics& stats = execution->getStatistics();
   stats.undetermined = 1;
 
+  perfHelper.begin("building a tree");
+
+  if (bulk) {
+    buildAll();
+  } else {
+    buildLive();
+  }
+
+  perfHelper.end();
+
+  const int orphans = read_queue->orphanCount() + restart_orphans;
+  if (orphans > 0) {
+    qDebug() << "nodes whose parent never arrived:" << orphans;
+  }
+
+  endClock = clock();
+  endTime = get_wall_time();
+
+  double elapsed_clock_secs = double(endClock - beginClock) / CLOCKS_PER_SEC;
+  //    qDebug() << "Time elapsed: " << elapsed_secs << " seconds";
+  qDebug() << "Elapsed CPU time:  " << elapsed_clock_secs << " seconds";
+  qDebug() << "Elapsed wall time: " << (endTime - beginTime) << " seconds";
+  // qDebug() << fixed << beginTime << "  ->  " << endTime;
+
+  qDebug() << "solutions:" << stats.solutions;
+  qDebug() << "failures:" << stats.failures;
+  qDebug() << "undetermined:" << stats.undetermined;
+
+
+  if (GlobalParser::isSet(GlobalParser::test_option)) {
+    reportIngest();
+  }
+
+  /// last: in test mode the conductor terminates on it
+  emit doneBuilding(true);
+}
+
+void TreeBuilder::buildLive() {
+  QMutex& dataMutex = _data->dataMutex;
+
   bool is_delayed;
 
-  perfHelper.begin("building a tree");
+  EntryBatch batch;
 
   while (true) {
-    while (!dataMutex.tryLock()) {/* qDebug() << "Can't lock, trying again"; */
-    };
+    /// look at isDone before the queue: everything received before
+    /// DONE is in the queue by the time isDone is true
+    const bool done = _data->isDone();
+
+    /// new entries are taken even while released ones are read,
+    /// as their children may be among them
+    const bool took = _data->takeEntries(batch);
+    if (took) appendBatch(batch);
 
     /// check if done
     if (!read_queue->canRead()) {
-      dataMutex.unlock();
+      if (took) continue;
 
-      if (_data->isDone()) {
+      if (done) {
 // <<<<<<< HEAD
 //         qDebug() << "stop because done ";
 //                  // << "tc_id: " << _tc->_id;
@@ -324,44 +468,254 @@ void TreeBuilder::run() {
         break;
       }
       /// can't read, but receiving not done, waiting...
-      msleep(1);
+      _data->waitForEntries();
       continue;
     }
 
-    /// ask queue for an entry, note: is_delayed gets assigned here
-    DbEntry* entry = read_queue->next(is_delayed);
+    {
+      /// the whole slice goes in under one acquisition of each lock
+      QMutexLocker locker(&dataMutex);
+      QMutexLocker treeLocker(&execution->getMutex());
+      QMutexLocker layoutLocker(&execution->getLayoutMutex());
+
+      for (int i = 0; i < BUILD_SLICE && read_queue->canRead(); ++i) {
+        /// ask queue for an entry, note: is_delayed gets assigned here
+        DbEntry entry = _data->entryAt(read_queue->next(is_delayed));
+        int aid = -1;
+        if (!is_delayed) aid = entries_read.fetch_add(1, std::memory_order_relaxed);
+
+        bool isRoot = (entry.parent_sid() == -1) ? true : false;
+
+        /// try to put node into the tree; if its parent is not there
+        /// yet, it waits in read_queue
+        if (isRoot) {
+          processRoot(entry, tree);
+        } else {
+          processNode(entry, tree);
+        }
+
+        if (aid >= 0) sampleLatency(aid);
+      }
+    }
+
+    if (tree.added > 0) {
+      emit addedNodes(tree.added);
+      tree.added = 0;
+    }
+  }
+}
+
+// Everything has been received, so entries are put into the tree without
+// closeChild or dirtyUp, and the canvas is told once at the end.  The
+// locks are still let go every BULK_SLICE entries, for the GUI thread.
+void TreeBuilder::buildAll() {
+  if (buildRestarts()) {
+    emit addedRoot();
+    emit addedNodes(tree.added);
+    tree.added = 0;
+    return;
+  }
 
-    bool isRoot = (entry->parent_sid == -1) ? true : false;
+  bool is_delayed;
 
-    /// try to put node into the tree
-    bool success =
-        isRoot ? processRoot(*entry) : processNode(*entry, is_delayed);
+  while (read_queue->canRead()) {
+    QMutexLocker locker(&_data->dataMutex);
+    QMutexLocker treeLocker(&execution->getMutex());
+    QMutexLocker layoutLocker(&execution->getLayoutMutex());
 
-    read_queue->update(success);
+    for (int i = 0; i < BULK_SLICE && read_queue->canRead(); ++i) {
+      DbEntry entry = _data->entryAt(read_queue->next(is_delayed));
+      if (!is_delayed) entries_read.fetch_add(1, std::memory_order_relaxed);
 
-    dataMutex.unlock();
+      if (entry.parent_sid() == -1) {
+        processRoot(entry, tree);
+      } else {
+        processNode(entry, tree);
+      }
+    }
   }
 
-  perfHelper.end();
+  {
+    QMutexLocker treeLocker(&execution->getMutex());
+    QMutexLocker layoutLocker(&execution->getLayoutMutex());
+    settleTree(_na);
+  }
 
-  emit doneBuilding(true);
+  emit addedRoot();
+  emit addedNodes(tree.added);
+  tree.added = 0;
+}
 
-  endClock = clock();
-  endTime = get_wall_time();
+struct TreeBuilder::RestartTree {
+  /// the restart's entries, in the order they were received
+  std::vector<int> aids;
+  NodeAllocator na;
+  ReadingQueue queue;
+  Statistics stats;
+  Shard shard;
+  /// where its root and the rest of its nodes go in the tree
+  int at = -1;
+  int base = 0;
+  /// entries without a parent
+  int roots = 0;
+
+  RestartTree() : queue(aids), shard(na, queue, stats, true) {
+    stats.undetermined = 0;
+  }
+};
+
+// Every restart is a subtree of its own under the super root, so each
+// can be built by a different thread, in a NodeAllocator of its own.
+// They are then renumbered (in parallel as well) and moved into the
+// tree in the order the restarts started, which is where the serial
+// build would have put them.  A restart with more than one root does not
+// fit in a subtree of its own (the serial build hangs every root off the
+// super root), so such an execution is left to the serial build.
+bool TreeBuilder::buildRestarts() {
+  const int threads =
+      std::min<int>(std::thread::hardware_concurrency(), MAX_BUILD_THREADS);
+  if (!execution->isRestarts() || threads < 2) return false;
+
+  const int n = _data->size();
+
+  /// restart id -> index in restarts
+  std::unordered_map<int, int> index;
+  std::vector<std::unique_ptr<RestartTree>> restarts;
+  int last_id = -1, last = -1;
+  for (int aid = 0; aid < n; ++aid) {
+    const DbEntry entry = _data->entryAt(aid);
+    const int restart_id = entry.restart_id();
+    if (restart_id != last_id || last < 0) {
+      auto it = index.find(restart_id);
+      if (it == index.end()) {
+        it = index.emplace(restart_id, restarts.size()).first;
+        restarts.emplace_back(new RestartTree);
+      }
+      last_id = restart_id;
+      last = it->second;
+    }
+    restarts[last]->aids.push_back(aid);
+    if (entry.parent_sid() == -1 && ++restarts[last]->roots > 1) {
+      qDebug() << "restart" << restart_id
+               << "has more than one root, building restarts serially";
+      return false;
+    }
+  }
+  if (restarts.size() < 2) return false;
+
+  /// runs `work` on every restart, `threads` at a time
+  auto forEachRestart = [&](const std::function<void(RestartTree&)>& work) {
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < std::min<int>(threads, restarts.size()); ++t) {
+      workers.emplace_back([&]() {
+        for (size_t i; (i = next.fetch_add(1)) < restarts.size();) {
+          work(*restarts[i]);
+        }
+      });
+    }
+    for (auto& worker : workers) worker.join();
+  };
+
+  std::atomic<int> read{0};
+  forEachRestart([&](RestartTree& restart) {
+    bool is_delayed;
+    int first_reads = 0;
+    while (restart.queue.canRead()) {
+      DbEntry entry = _data->entryAt(restart.queue.next(is_delayed));
+      if (!is_delayed) ++first_reads;
+
+      if (entry.parent_sid() == -1) {
+        processRoot(entry, restart.shard);
+      } else {
+        processNode(entry, restart.shard);
+      }
+    }
+    settleTree(restart.na);
+    read.fetch_add(first_reads, std::memory_order_relaxed);
+  });
+  entries_read.fetch_add(read.load(), std::memory_order_relaxed);
 
-  double elapsed_clock_secs = double(endClock - beginClock) / CLOCKS_PER_SEC;
-  //    qDebug() << "Time elapsed: " << elapsed_secs << " seconds";
-  qDebug() << "Elapsed CPU time:  " << elapsed_clock_secs << " seconds";
-  qDebug() << "Elapsed wall time: " << (endTime - beginTime) << " seconds";
-  // qDebug() << fixed << beginTime << "  ->  " << endTime;
+  QMutexLocker locker(&_data->dataMutex);
+  QMutexLocker treeLocker(&execution->getMutex());
+  QMutexLocker layoutLocker(&execution->getLayoutMutex());
 
-  qDebug() << "solutions:" << stats.solutions;
-  qDebug() << "failures:" << stats.failures;
-  qDebug() << "undetermined:" << stats.undetermined;
+  Statistics& stats = tree.stats;
+  VisualNode* super_root = _na[0];
 
+  /// one child of the super root per restart, then their subtrees
+  for (auto& restart : restarts) {
+    if (restart->na.size() > 0) restart->at = super_root->addChild(_na);
+  }
+  int base = _na.size();
+  for (auto& restart : restarts) {
+    if (restart->at < 0) continue;
+    restart->base = base;
+    base += restart->na.size() - 1;
+  }
+  _data->gid2entry.reserve(base, _data->entryAt(0).columns());
+
+  forEachRestart([&](RestartTree& restart) {
+    if (restart.at < 0) return;
+    restart.na.renumber(restart.at, 0, restart.base);
+    for (int aid : restart.aids) {
+      DbEntry entry = _data->entryAt(aid);
+      const int gid = entry.gid();
+      if (gid < 0) continue;
+      entry.set_gid(gid == 0 ? restart.at : restart.base + gid - 1);
+      _data->connectNodeToEntry(entry.gid(), entry);
+    }
+  });
 
-  if (GlobalParser::isSet(GlobalParser::test_option)) {
-    qDebug() << "test mode, terminate";
-    qApp->exit();
+  for (auto& restart : restarts) {
+    if (restart->at >= 0) _na.adopt(restart->na, restart->at);
+
+    stats.solutions += restart->stats.solutions;
+    stats.failures += restart->stats.failures;
+    stats.choices += restart->stats.choices;
+    stats.undetermined += restart->stats.undetermined;
+    stats.maxDepth = std::max(stats.maxDepth, restart->stats.maxDepth);
+
+    tree.added += restart->shard.added;
+    tree.ignored.insert(tree.ignored.end(), restart->shard.ignored.begin(),
+                        restart->shard.ignored.end());
+    restart_orphans += restart->queue.orphanCount();
+  }
+
+  /// the super root is effectively a branch node
+  super_root->setStatus(BRANCH);
+  super_root->setChildrenLayoutDone(false);
+  settleNode(*super_root, _na);
+  super_root->setDirty(true);
+
+  restarts_built = restarts.size();
+  return true;
+}
+
+// A child is always allocated after its parent, so going down from the
+// last gid every node's children are final when it is reached.  Also
+// marks every node dirty, as a layout while the tree was being built
+// may have cleaned some.
+void TreeBuilder::settleTree(NodeAllocator& na) {
+  for (int gid = na.size() - 1; gid >= 0; --gid) {
+    VisualNode* node = na[gid];
+    node->setDirty(true);
+    settleNode(*node, na);
+  }
+}
+
+void TreeBuilder::settleNode(VisualNode& node, const NodeAllocator& na) {
+  const int kids = node.getNumberOfChildren();
+  if (kids == 0) return;
+
+  bool open = false, solved = false, failed = false;
+  for (int i = 0; i < kids; ++i) {
+    VisualNode* kid = node.getChild(na, i);
+    open = open || kid->isOpen();
+    solved = solved || kid->hasSolvedChildren();
+    failed = failed || kid->hasFailedChildren();
   }
+  node.setHasOpenChildren(open);
+  node.setHasSolvedChildren(solved);
+  node.setHasFailedChildren(failed);
 }
@@ -24,9 +24,11 @@
 
 #include <QtGui>
 #include <vector>
+#include <deque>
 #include <queue>
 #include "data.hh"
 #include "execution.hh"
+#include <atomic>
 #include <memory>
 
 class Data;
@@ -34,6 +36,7 @@ class DbEntry;
 class Execution;
 class ReadingQueue;
 class TreeCanvas;
+class VisualNode;
 class NodeAllocator;
 
 enum NodeStatus : char;
@@ -47,12 +50,89 @@ class TreeBuilder : public QThread {
   Execution* execution;
   QMutex* layout_mutex;
 
-  std::vector<DbEntry*> ignored_entries;
-
   std::unique_ptr<ReadingQueue> read_queue;
 
-  bool processRoot(DbEntry& dbEntry);
-  bool processNode(DbEntry& dbEntry, bool is_delayed);
+  /// Where processRoot and processNode put entries: the tree itself, or
+  /// the subtree of a single restart in a NodeAllocator of its own (with
+  /// gids local to it, see buildRestarts)
+  struct Shard {
+    NodeAllocator& na;
+    ReadingQueue& queue;
+    Statistics& stats;
+    bool local;
+    /// nodes added since the last addedNodes
+    int added = 0;
+    std::vector<DbEntry> ignored;
+
+    Shard(NodeAllocator& na, ReadingQueue& queue, Statistics& stats, bool local)
+        : na(na), queue(queue), stats(stats), local(local) {}
+  };
+  Shard tree;
+
+  /// a restart built by buildRestarts, and what it needs
+  struct RestartTree;
+  /// entries whose parent never arrived, in restarts built on their own
+  int restart_orphans = 0;
+  /// number of restarts buildRestarts built (0 if it did not)
+  int restarts_built = 0;
+
+  /// number of entries taken from Data for the first time
+  std::atomic<int> entries_read{0};
+
+  /// Every ARRIVAL_SAMPLE-th array id with the time its entry was
+  /// received, for measuring how long nodes wait for the tree
+  static constexpr int ARRIVAL_SAMPLE = 256;
+  std::deque<std::pair<int, std::chrono::steady_clock::time_point>> arrivals;
+  std::chrono::steady_clock::time_point first_received;
+
+  /// receive-to-tree latencies (microseconds) of the entries in
+  /// arrivals, reported in test mode
+  std::vector<long long> latencies;
+  void sampleLatency(int aid);
+
+  /// largest number of entries seen waiting in Data's queue, and
+  /// received but not yet read by the builder
+  int peak_queue_depth = 0;
+  int peak_lag = 0;
+
+  void reportIngest() const;
+
+  /// entries processed per dataMutex acquisition
+  static constexpr int BUILD_SLICE = 256;
+
+  /// Store a batch taken from Data's queue
+  void appendBatch(const EntryBatch& batch);
+
+  /// Put an entry into the shard's tree; for `tree`, the execution and
+  /// layout mutexes are held for a whole slice of entries
+  bool processRoot(DbEntry dbEntry, Shard& shard);
+  bool processNode(DbEntry dbEntry, Shard& shard);
+
+  /// Whether the whole execution is in Data already (loaded from a
+  /// file), so the tree can be built in one go
+  bool bulk = false;
+  /// entries put into the tree per lock acquisition in bulk mode
+  static constexpr int BULK_SLICE = 1 << 16;
+  /// most threads building restarts at once in bulk mode
+  static constexpr int MAX_BUILD_THREADS = 16;
+
+  /// closeChild and dirtyUp, unless settleTree does them for all nodes
+  void closeChild(Shard& shard, VisualNode& parent, bool failed, bool solved);
+  void nodeAdded(Shard& shard, VisualNode& node);
+  /// Put the entry in gid2entry, unless the gid is local to the shard
+  void connectEntry(Shard& shard, int gid, DbEntry entry);
+
+  /// Build the tree as entries arrive
+  void buildLive();
+  /// Build the tree of a complete execution, then settleTree
+  void buildAll();
+  /// Build the restarts of a complete execution on several threads,
+  /// then put them under the super root; false if not worth it
+  bool buildRestarts();
+  /// Set the open/solved/failed flags of all nodes of `na` in one
+  /// bottom-up pass and mark them dirty
+  static void settleTree(NodeAllocator& na);
+  static void settleNode(VisualNode& node, const NodeAllocator& na);
 
   void run() override;
 
@@ -62,9 +142,16 @@ class TreeBuilder : public QThread {
   TreeBuilder(Execution* execution, QObject* parent = 0);
   ~TreeBuilder();
 
+  /// Build the tree of a complete execution in one go
+  void startBulk();
+
+  /// Can be called from any thread
+  int entriesRead() const { return entries_read.load(std::memory_order_relaxed); }
+
 Q_SIGNALS:
   void doneBuilding(bool finished);
-  void addedNode(void);
+  /// one notification per slice rather than per node
+  void addedNodes(int count);
   void addedRoot(void);
 
  public Q_SLOTS:
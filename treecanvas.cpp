@@ -93,7 +93,7 @@ TreeCanvas::TreeCanvas(Execution* execution_, QGridLayout* layout,
   connect(this, SIGNAL(autoZoomChanged(bool)), autoZoomButton,
           SLOT(setChecked(bool)));
 
-  connect(execution, SIGNAL(newNode()), this, SLOT(maybeUpdateCanvas()));
+  connect(execution, &Execution::newNodes, this, &TreeCanvas::maybeUpdateCanvas);
   connect(execution, &Execution::newRoot, this, &TreeCanvas::updateCanvas);
 
   // connect(ptr_receiver, SIGNAL(update(int,int,int)), this,
@@ -360,12 +360,12 @@ void print_debug(const Data& data) {
 void TreeCanvas::showNodeInfo(void) {
   auto info = execution->getInfo(*currentNode);
 
-  if (!info) {
+  if (info.empty()) {
     qDebug() << "no info item";
     return;
   }
 
-  NodeInfoDialog* nidialog = new NodeInfoDialog(this, *info);
+  NodeInfoDialog* nidialog = new NodeInfoDialog(this, info);
   nidialog->show();
 }
 
@@ -1151,10 +1151,10 @@ bool TreeCanvas::getMoveDuringSearch(void) { return moveDuringSearch; }
 
 void TreeCanvas::setMoveDuringSearch(bool b) { moveDuringSearch = b; }
 
-// Call this when there is a new node, and the canvas will update if
-// the refresh rate says that it should.
-void TreeCanvas::maybeUpdateCanvas(void) {
-  nodeCount++;
+// Call this when there are `count` new nodes, and the canvas will update
+// if the refresh rate says that it should.
+void TreeCanvas::maybeUpdateCanvas(int count) {
+  nodeCount += count;
   if (nodeCount >= refresh) {
     nodeCount = 0;
     updateCanvas();
@@ -1261,7 +1261,7 @@ void TreeCanvas::highlightNodesWithInfo() {
 
     auto info = execution->getInfo(*node);
 
-    if (!info) {
+    if (info.empty()) {
       return false;
     }
 
@@ -1282,9 +1282,9 @@ void TreeCanvas::highlightFailedByNogoods() {
   auto predicate = [this](VisualNode* node) {
     auto info = execution->getInfo(*node);
 
-    if (!info) return false;
+    if (info.empty()) return false;
 
-    auto info_json = nlohmann::json::parse(*info);
+    auto info_json = nlohmann::json::parse(info);
 
     auto nogoods = info_json["nogoods"];
 
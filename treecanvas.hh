@@ -85,7 +85,7 @@ public:
   }
   unsigned long long getTotalTime() const { return execution->getTotalTime(); }
   std::string getTitle() const { return execution->getTitle(); }
-  DbEntry* getEntry(unsigned int gid) { return execution->getEntry(gid); }
+  DbEntry getEntry(unsigned int gid) { return execution->getEntry(gid); }
 
 
   const Statistics& get_stats() const { return execution->getStatistics(); }
@@ -388,7 +388,7 @@ public:
 
 
 public Q_SLOTS:
-  void maybeUpdateCanvas(void);
+  void maybeUpdateCanvas(int count);
   void updateCanvas(void);
   /// Update display
   void update(void);
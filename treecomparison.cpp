@@ -185,7 +185,7 @@ TreeComparison::compare(TreeCanvas* new_tc, bool with_labels) {
             unsigned int source_index = node2->getIndex(_na2);
             unsigned int target_index = next->getIndex(na);
 
-            DbEntry* entry = _ex2.getEntry(source_index);
+            DbEntry entry = _ex2.getEntry(source_index);
             new_tc->getExecution()->getData()->connectNodeToEntry(target_index, entry);
 
             for (unsigned int i = 0; i < kids; ++i) {
@@ -223,7 +223,7 @@ TreeComparison::compare(TreeCanvas* new_tc, bool with_labels) {
                 next->getChild(na, 1)->setHidden(true);
             }
 
-            const string* info_str = nullptr;
+            string info_str;
             /// if node1 is FAILED -> check nogoods // TODO(maxim): branch node?
             if (node1->getStatus() == FAILED) {
                 info_str = _ex1.getInfo(*node1);
@@ -232,10 +232,10 @@ TreeComparison::compare(TreeCanvas* new_tc, bool with_labels) {
                 assert(left == 1);
                 search_reduction = right - left;
                 /// identify nogoods and increment counters
-                if (info_str) analyseNogoods(*info_str, search_reduction);
+                if (!info_str.empty()) analyseNogoods(info_str, search_reduction);
             }
 
-            m_pentagonItems.emplace_back(PentagonItem{left, right, next, info_str});
+            m_pentagonItems.emplace_back(PentagonItem{left, right, next, std::move(info_str)});
 
 
         }
@@ -283,20 +283,17 @@ TreeComparison::copyTree(VisualNode* target, TreeCanvas* tc,
 
         if (n->getStatus() != NodeStatus::UNDETERMINED) {
             auto source_data = ex_source.getData();
-            DbEntry* entry = source_data->getEntry(source_index);
+            DbEntry entry = source_data->getEntry(source_index);
 
             auto this_data = tc->getExecution()->getData();
             this_data->connectNodeToEntry(target_index, entry);
 
             /// TODO(maxim): connect nogoods as well
 
-            auto sid = entry->s_node_id;
-            auto info = source_data->sid2info.find(sid);
-
             /// note(maxim): should have to maintain another map
-            /// (even though info is only a pointer)
-            if (info != source_data->sid2info.end()) {
-                this_data->sid2info[sid] = info->second;
+            if (entry) {
+                auto info = source_data->sid2info.get(entry.full_sid());
+                if (!info.empty()) this_data->sid2info.add(entry.full_sid(), info);
             }
 
         }
@@ -336,6 +333,13 @@ TreeComparison::copmareNodes(const VisualNode* n1, const VisualNode* n2, bool wi
             int id1 = n1->getChild(i);
             int id2 = n2->getChild(i);
 
+            /// labels are interned across executions, so equal ids
+            /// mean equal labels and the strings are not needed
+            auto entry1 = _ex1.getEntry(id1);
+            auto entry2 = _ex2.getEntry(id2);
+            if (entry1 && entry2 && entry1.label_id() == entry2.label_id())
+                continue;
+
             auto label1 = _ex1.getLabel(id1);
             auto label2 = _ex2.getLabel(id2);
 
@@ -38,9 +38,9 @@ struct PentagonItem {
   int l_size;               /// left subtree size
   int r_size;               /// right subtree size
   VisualNode* node;         /// pentagon node
-  const std::string* info;  /// pentagon info -> now used for nogoods
+  std::string info;         /// pentagon info -> now used for nogoods
   PentagonItem(int l_size, int r_size, VisualNode* node,
-               const std::string* info = nullptr)
+               std::string info = std::string())
       : l_size(l_size), r_size(r_size), node(node), info(info) {}
 };
 
@@ -39,6 +39,7 @@
 #define VISUALNODE_HH
 
 #include "spacenode.hh"
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -100,6 +101,8 @@ private:
   /// Constructor
   Shape(void);
 public:
+  /// Bytes of a shape of depth \a d
+  static size_t bytes(int d);
   /// Construct shape of depth \a d
   static Shape* allocate(int d);
   /// Destruct
@@ -244,6 +247,8 @@ public:
   void setShape(Shape* s);
   /// Compute the shape according to the shapes of the children
   void computeShape(const NodeAllocator& na);
+  /// Bytes of the extents of this node's own shape (not the shared ones)
+  size_t shapeBytes(void) const;
   /// Return the bounding box
   BoundingBox getBoundingBox(void);
   /// Find a node in this subtree at coordinates \a x, \a y
@@ -268,10 +273,33 @@ public:
 class NodeAllocator {
 private:
 
-  std::vector<VisualNode*> nodes;
+  /// The nodes themselves, in segments of doubling size like
+  /// EntryColumns: a segment never moves, so neither does a node, and
+  /// a small tree (a restart built on its own) takes little room
+  static constexpr int FIRST_BITS = 10;
+  static constexpr int MAX_SEGMENTS = 31 - FIRST_BITS;
+  VisualNode* segments[MAX_SEGMENTS] = {};
+  int _size = 0;
+
+  static int segmentCapacity(int seg) { return 1 << (seg + FIRST_BITS); }
+
+  static void locate(int i, int& seg, int& off) {
+    const unsigned j = static_cast<unsigned>(i) + (1u << FIRST_BITS);
+    const int bit = 31 - __builtin_clz(j);
+    seg = bit - FIRST_BITS;
+    off = static_cast<int>(j - (1u << bit));
+  }
+
+  /// Room for node size(), not constructed yet
+  VisualNode* next();
 
   /// Hash table mapping nodes to label text
   QHash<VisualNode*, QString> labels;
+
+  /// Bytes of child arrays and of shapes, kept up to date by Node,
+  /// LayoutCursor (for shapes replaced) and DisposeCursor
+  std::atomic<long long> child_bytes{0};
+  mutable std::atomic<long long> shape_bytes{0};
 public:
   NodeAllocator();
   ~NodeAllocator();
@@ -299,6 +327,24 @@ public:
   /// returns the total number of nodes allocated
   int size() const;
 
+  /// Renumber the nodes of this tree for moving them into another
+  /// allocator by adopt: the root becomes node \a at there, a child of
+  /// \a parent, and node i > 0 becomes \a base + i - 1
+  void renumber(int at, int parent, int base);
+  /// Take over the nodes of \a tree, renumbered with base size(): its
+  /// root replaces node \a at, the others are appended (copied; \a tree
+  /// is left empty)
+  void adopt(NodeAllocator& tree, int at);
+
+  /// Bytes of the nodes themselves
+  size_t bytes() const;
+  /// Account for child arrays growing by \a bytes
+  void countChildBytes(long long bytes);
+  size_t childBytes() const;
+  /// Account for shapes growing by \a bytes
+  void countShapeBytes(long long bytes) const;
+  size_t shapeBytes() const;
+
 };
 
 #include "node.hpp"
@@ -39,37 +39,56 @@
 #define VISUALNODE_HPP
 
 #include <iostream>
+#include <new>
+#include <type_traits>
 
 #ifdef MAXIM_DEBUG
 #include <QDebug>
 #endif
 
-inline NodeAllocator::NodeAllocator() {
-  nodes.reserve(1000);
-}
+// A node owns nothing its destructor would free (shapes and child
+// arrays go by dispose), so the segments are freed without running any
+static_assert(std::is_trivially_destructible<VisualNode>::value,
+              "NodeAllocator frees nodes without destroying them");
+
+inline NodeAllocator::NodeAllocator() {}
 
 inline NodeAllocator::~NodeAllocator(void) {
-  for (auto &node : nodes) {
-    delete node;
+  for (auto segment : segments) {
+    ::operator delete(segment);
   }
 }
 
+inline VisualNode* NodeAllocator::next() {
+  int seg, off;
+  locate(_size, seg, off);
+  if (!segments[seg]) {
+    segments[seg] = static_cast<VisualNode*>(
+        ::operator new(segmentCapacity(seg) * sizeof(VisualNode)));
+  }
+  return segments[seg] + off;
+}
+
 inline int NodeAllocator::allocate(int p) {
-  nodes.push_back(new VisualNode{p});
-  return nodes.size() - 1;
+  VisualNode* node = new (next()) VisualNode{p};
+  node->index = _size;
+  return _size++;
 }
 
 inline int NodeAllocator::allocateRoot() {
 #ifdef MAXIM_DEBUG
   qDebug() << "allocated root";
 #endif
-  nodes.push_back(new VisualNode{});
-  return nodes.size() - 1;
+  VisualNode* node = new (next()) VisualNode{};
+  node->index = _size;
+  return _size++;
 }
 
 inline VisualNode* NodeAllocator::operator[](int i) const {
-  assert(static_cast<uint>(i) < nodes.size());
-  return nodes[i];
+  assert(static_cast<uint>(i) < static_cast<uint>(_size));
+  int seg, off;
+  locate(i, seg, off);
+  return segments[seg] + off;
 }
 
 inline bool NodeAllocator::showLabels(void) const { return !labels.isEmpty(); }
@@ -92,7 +111,57 @@ inline QString NodeAllocator::getLabel(VisualNode* n) const {
 }
 
 inline int NodeAllocator::size() const {
-  return nodes.size();
+  return _size;
+}
+
+inline void NodeAllocator::renumber(int at, int parent, int base) {
+  auto map = [at, parent, base](int i) {
+    return i < 0 ? parent : (i == 0 ? at : base + i - 1);
+  };
+  for (int i = 0; i < _size; ++i) {
+    (*this)[i]->renumber(map);
+  }
+}
+
+inline void NodeAllocator::adopt(NodeAllocator& tree, int at) {
+  assert(tree._size > 0);
+  /// the placeholder's shape, if it was laid out, goes with it
+  VisualNode* placeholder = (*this)[at];
+  countShapeBytes(-static_cast<long long>(placeholder->shapeBytes()));
+  placeholder->dispose();
+  *placeholder = *tree[0];
+  for (int i = 1; i < tree._size; ++i) {
+    new (next()) VisualNode(*tree[i]);
+    ++_size;
+  }
+  tree._size = 0;
+
+  child_bytes.fetch_add(tree.child_bytes.exchange(0), std::memory_order_relaxed);
+  shape_bytes.fetch_add(tree.shape_bytes.exchange(0), std::memory_order_relaxed);
+}
+
+inline size_t NodeAllocator::bytes() const {
+  size_t total = 0;
+  for (int seg = 0; seg < MAX_SEGMENTS && segments[seg]; ++seg) {
+    total += segmentCapacity(seg) * sizeof(VisualNode);
+  }
+  return total;
+}
+
+inline void NodeAllocator::countChildBytes(long long bytes) {
+  child_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+inline size_t NodeAllocator::childBytes() const {
+  return child_bytes.load(std::memory_order_relaxed);
+}
+
+inline void NodeAllocator::countShapeBytes(long long bytes) const {
+  shape_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+inline size_t NodeAllocator::shapeBytes() const {
+  return shape_bytes.load(std::memory_order_relaxed);
 }
 
 inline Extent::Extent(void) : l(-1), r(-1) {}
@@ -132,11 +201,14 @@ inline Extent& Shape::operator[](int i) {
   return shape[i];
 }
 
+inline size_t Shape::bytes(int d) {
+  return sizeof(Shape) + (d - 1) * sizeof(Extent);
+}
+
 inline Shape* Shape::allocate(int d) {
   assert(d >= 1);
   Shape* ret;
-  ret = static_cast<Shape*>(
-      heap.ralloc(sizeof(Shape) + (d - 1) * sizeof(Extent)));
+  ret = static_cast<Shape*>(heap.ralloc(bytes(d)));
   ret->_depth = d;
   return ret;
 }
@@ -241,6 +313,12 @@ inline Shape* VisualNode::getShape(void) {
   return shape;
 }
 
+inline size_t VisualNode::shapeBytes(void) const {
+  if (shape == nullptr || shape == Shape::leaf || shape == Shape::hidden)
+    return 0;
+  return Shape::bytes(shape->depth());
+}
+
 inline BoundingBox VisualNode::getBoundingBox(void) {
   return getShape()->getBoundingBox();
 }